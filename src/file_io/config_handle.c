@@ -129,14 +129,54 @@ static void config_check(void)
     config[32]  = isfinite(config[32])  ? config[32]  : (double)true;
     // Dimensional splitting
     config[33]  = isfinite(config[33])  ? config[33]  : (double)false;
+    // VTK output format (legacy ASCII/VTU raw binary/VTU zlib compressed)
+    config[34]  = isfinite(config[34])  ? config[34]  : (double)0;
+    // Write grid once (grid files + solution files of fluid variables)
+    config[35]  = isfinite(config[35])  ? config[35]  : (double)false;
+    // In-situ analysis interval (time steps)
+    config[36]  = isfinite(config[36])  ? config[36]  : (double)0;
+    // Bilinear interpolation on probes
+    config[37]  = isfinite(config[37])  ? config[37]  : (double)false;
+    // Health monitor
+    config[38]  = isfinite(config[38])  ? config[38]  : (double)false;
+    // Tolerance of relative drift of total mass and energy in health monitor
+    config[39]  = isfinite(config[39])  ? config[39]  : 0.0;
     // Slope limiter for least square procedure (Venkatakrishnan/Barth-Jespersen)
     config[40]  = isfinite(config[40])  ? config[40]  : (double)0;
     // Parameter α in minmod limiter
     config[41]  = isfinite(config[41])  ? config[41]  : 1.9;
     // Slope limiter for minmod VIP
     config[42]  = isfinite(config[42])  ? config[42]  : (double)1;
+    // Maximum Mach number in health monitor
+    config[43]  = isfinite(config[43])  ? config[43]  : 0.0;
+    // First-order fallback of troubled cells (MOOD)
+    config[44]  = isfinite(config[44])  ? config[44]  : (double)false;
+    // Mesh motion strategy on ALE coordinate (Eulerian/Lagrangian/adaptive)
+    config[45]  = isfinite(config[45])  ? config[45]  : (double)2;
+    // Monitor coefficient β of adaptive mesh motion
+    config[46]  = isfinite(config[46])  ? config[46]  : 2.0;
+    // Relaxation ω of adaptive mesh motion
+    config[47]  = isfinite(config[47])  ? config[47]  : 1.0;
+    // Minimum number of grid cells for OpenMP threads in 1-D loops
+    config[48]  = isfinite(config[48])  ? config[48]  : (double)4096;
+    // Number of time steps per tile of temporal blocking in 1-D Eulerian scheme
+    config[49]  = isfinite(config[49])  ? config[49]  : (double)1;
+    // Number of grid cells per tile of temporal blocking
+    config[50]  = isfinite(config[50])  ? config[50]  : (double)2048;
+    // Whether quiescent interfaces in uniform regions skip the Riemann solvers in 2-D schemes
+    config[51]  = isfinite(config[51])  ? config[51]  : (double)false;
+    // Pressure ratio bound of weak jumps for adaptive Riemann solver in 2-D schemes
+    config[52]  = isfinite(config[52])  ? config[52]  : 0.0;
     // Runge-Kutta time discretization
     config[53]  = isfinite(config[53])  ? config[53]  : (double)false;
+    // Whether the face kernels on unstructured grids gather from the packed per-cell state
+    config[54]  = isfinite(config[54])  ? config[54]  : (double)false;
+    // Edge of the tiles of the OpenMP task graph in 2-D GRP schemes on structured grids
+    config[55]  = isfinite(config[55])  ? config[55]  : (double)0;
+    // Auto-tuning of the OpenMP threads, schedules and tile edge of 2-D GRP kernels
+    config[56]  = isfinite(config[56])  ? config[56]  : (double)0;
+    // Upper bound of the adaptive CFL number with the rollback of failed time steps
+    config[57]  = isfinite(config[57])  ? config[57]  : 0.0;
     // Conservative variable (U_gamma) ργ
     config[60]  = isfinite(config[60])  ? config[60]  : (double)false;
     // v_fix: Shear velocity
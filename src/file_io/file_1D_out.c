@@ -29,8 +29,9 @@
 	for(k = 0; k < N; ++k)						\
 	    {								\
 		for(j = 0; j < m; ++j)					\
-		    fprintf(fp_write, "%.10g\t", (v_print));		\
-		fprintf(fp_write, "\n");				\
+		    U_print[j] = (v_print);				\
+		if(!flu_var_write(fp_write, U_print, m, m, "\n"))	\
+		    exit(1);						\
 	    }								\
 	fclose(fp_write);						\
     } while (0)
@@ -68,6 +69,12 @@ void file_1D_write(const int m, const int N, const struct cell_var_stru CV,
 //===================Write Output Data File=========================
 
     int k, j;
+    double * U_print = (double *)malloc(m * sizeof(double));
+    if(U_print == NULL)
+	{
+	    printf("Not enough memory in solution output!\n");
+	    exit(5);
+	}
     PRINT_NC(RHO, CV.RHO[k][j]);
     PRINT_NC(U,   CV.U[k][j]);
     PRINT_NC(P,   CV.P[k][j]);
@@ -77,6 +84,7 @@ void file_1D_write(const int m, const int N, const struct cell_var_stru CV,
 #else
     PRINT_NC(X, 0.5 * (X[k][j] + X[k][j+1]));
 #endif
+    free(U_print);
 
     strcpy(file_data, add_out);
     strcat(file_data, "time_plot.dat");
@@ -10,6 +10,7 @@
 #include <time.h>
 
 #include "../include/var_struc.h"
+#include "../include/tools.h"
 #include "../include/file_io.h"
 
 
@@ -29,11 +30,10 @@
     for(k = 0; k < N; ++k)						\
 	{								\
 	    for(i = 0; i < n_y; ++i)					\
-		{							\
-		    for(j = 0; j < n_x; ++j)				\
-			fprintf(fp_write, "%.10g\t", (v_print));	\
-		    fprintf(fp_write, "\n");				\
-		}							\
+		for(j = 0; j < n_x; ++j)				\
+		    U_print[i*n_x+j] = (v_print);			\
+	    if(!flu_var_write(fp_write, U_print, n_x*n_y, n_x, "\n"))	\
+		exit(1);						\
 	    fprintf(fp_write, "\n\n");					\
 	}								\
     fclose(fp_write);							\
@@ -65,6 +65,12 @@ void file_2D_write(const int n_x, const int n_y, const int N, const struct cell_
 //===================Write Solution File=========================
 
     int k, i, j;
+    double * U_print = (double *)malloc(n_x * n_y * sizeof(double));
+    if(U_print == NULL)
+	{
+	    printf("Not enough memory in solution output!\n");
+	    exit(5);
+	}
     PRINT_NC(RHO, CV[k].RHO[j][i]);
     PRINT_NC(U,   CV[k].U[j][i]);
     PRINT_NC(V,   CV[k].V[j][i]);
@@ -72,6 +78,7 @@ void file_2D_write(const int n_x, const int n_y, const int N, const struct cell_
     PRINT_NC(E,   CV[k].E[j][i]);
     PRINT_NC(X, 0.25*(X[j][i] + X[j][i+1] + X[j+1][i] + X[j+1][i+1]));
     PRINT_NC(Y, 0.25*(Y[j][i] + Y[j][i+1] + Y[j+1][i] + Y[j+1][i+1]));
+    free(U_print);
     
     strcpy(file_data, add_out);
     strcat(file_data, "time_plot.dat");
@@ -88,8 +95,63 @@ void file_2D_write(const int n_x, const int n_y, const int N, const struct cell_
 }
 
 
+/**
+ * @brief This function write the cell centres of the structured grid into a Tecplot grid file 'GRID_*.tec'
+ *        if the grid has changed since the last call.
+ * @param[in] n_x: The number of x-spatial points in the output data.
+ * @param[in] n_y: The number of y-spatial points in the output data.
+ * @param[in] X:   Array of the x-coordinate data.
+ * @param[in] Y:   Array of the y-coordinate data.
+ * @param[in] add_out: Folder path of the output files.
+ * @param[in] time:    The plotting time.
+ */
+static void tec_grid_write(const int n_x, const int n_y, double ** X, double ** Y, const char * add_out, const double time)
+{
+    double const eps = config[4];
+    static unsigned long long hash_last = 0;
+    static char add_last[FILENAME_MAX+40] = "";
+    // FNV-1a hash of the grid node coordinates to detect the grid change.
+    unsigned long long hash = HASH_FNV1A_INIT;
+    int i, j;
+    for(j = 0; j <= n_x; ++j)
+	{
+	    hash = hash_fnv1a(hash, X[j], (n_y+1) * sizeof(double));
+	    hash = hash_fnv1a(hash, Y[j], (n_y+1) * sizeof(double));
+	}
+    if (hash == hash_last && strcmp(add_out, add_last) == 0)
+	return;
+
+    char file_data[FILENAME_MAX+40], str_tmp[40];
+    FILE * fp;
+    strcpy(file_data, add_out);
+    sprintf(str_tmp, "GRID_%.8g.tec", time + eps);
+    strcat(file_data, str_tmp);
+    if ((fp = fopen(file_data, "w")) == NULL)
+	{
+	    fprintf(stderr, "Cannot open grid output TECPLOT file!\n");
+	    exit(1);
+	}
+    fprintf(fp, "TITLE = \"FE-Volume Point Grid\"\n");
+    fprintf(fp, "FILETYPE = GRID\n");
+    fprintf(fp, "VARIABLES = \"X\", \"Y\"\n");
+    fprintf(fp, "ZONE I=%d, J=%d, DATAPACKING=POINT\n", n_x, n_y);
+    for(i = 0; i < n_y; ++i)
+	for(j = 0; j < n_x; ++j)
+	    {
+		fprintf(fp, "%.10g\t", 0.25*(X[j][i] + X[j][i+1] + X[j+1][i] + X[j+1][i+1]));
+		fprintf(fp, "%.10g\t", 0.25*(Y[j][i] + Y[j][i+1] + Y[j+1][i] + Y[j+1][i+1]));
+		fprintf(fp, "\n");
+	    }
+    fclose(fp);
+
+    hash_last = hash;
+    strcpy(add_last, add_out);
+}
+
 /**
  * @brief This function write the 2-D solution into Tecplot output files with point data.
+ * @details If config[35] is true, the cell centres are written into 'GRID_*.tec' only once per grid change,
+ *          and the solution files only contain the fluid variables.
  * @param[in] n_x: The number of x-spatial points in the output data.
  * @param[in] n_y: The number of y-spatial points in the output data.
  * @param[in] N:   The number of time steps in the output data.
@@ -104,9 +166,12 @@ void file_2D_write_POINT_TEC(const int n_x, const int n_y, const int N, const st
 			double ** X, double ** Y, const double * cpu_time, const char * problem, const double time_plot[])
 {
     double const eps = config[4];
+    const _Bool grid_once = (_Bool)config[35];
     char add_out[FILENAME_MAX+40];
     // Get the address of the output data folder of the test example.
     example_io(problem, add_out, 0);
+    if (grid_once)
+	tec_grid_write(n_x, n_y, X, Y, add_out, time_plot[0]);
     
     char file_data[FILENAME_MAX+40];
     FILE * fp;
@@ -124,28 +189,50 @@ void file_2D_write_POINT_TEC(const int n_x, const int n_y, const int N, const st
 	}
 
     fprintf(fp, "TITLE = \"FE-Volume Point Data\"\n");
-    fprintf(fp, "VARIABLES = \"X\", \"Y\"");
-    fprintf(fp, ", \"P\", \"RHO\", \"U\", \"V\", \"E\"");
+    if (grid_once)
+	{
+	    fprintf(fp, "FILETYPE = SOLUTION\n");
+	    fprintf(fp, "VARIABLES = \"P\", \"RHO\", \"U\", \"V\", \"E\"");
+	}
+    else
+	{
+	    fprintf(fp, "VARIABLES = \"X\", \"Y\"");
+	    fprintf(fp, ", \"P\", \"RHO\", \"U\", \"V\", \"E\"");
+	}
     fprintf(fp, "\n");
 
+    const int n_col = grid_once ? 5 : 7;
+    double * U_print = (double *)malloc(n_col * n_x * n_y * sizeof(double));
+    double * U_p;
+    if(U_print == NULL)
+	{
+	    fprintf(stderr, "Not enough memory in TECPLOT output!\n");
+	    exit(5);
+	}
     for(k = 0; k < N; ++k)
 	{
 	    // if (k == N-1)
 		// continue;
 	    fprintf(fp, "ZONE I=%d, J=%d, SOLUTIONTIME=%.10g, DATAPACKING=POINT\n", n_x, n_y, time_plot[k]);
+	    U_p = U_print;
 	    for(i = 0; i < n_y; ++i)
 		for(j = 0; j < n_x; ++j)
 		    {			    
-			fprintf(fp, "%.10g\t", 0.25*(X[j][i] + X[j][i+1] + X[j+1][i] + X[j+1][i+1]));
-			fprintf(fp, "%.10g\t", 0.25*(Y[j][i] + Y[j][i+1] + Y[j+1][i] + Y[j+1][i+1]));
-			fprintf(fp, "%.10g\t", CV[k].P[j][i]);
-			fprintf(fp, "%.10g\t", CV[k].RHO[j][i]);
-			fprintf(fp, "%.10g\t", CV[k].U[j][i]);
-			fprintf(fp, "%.10g\t", CV[k].V[j][i]);
-			fprintf(fp, "%.10g\t", CV[k].E[j][i]);
-			fprintf(fp, "\n");
+			if (!grid_once)
+			    {
+				*U_p++ = 0.25*(X[j][i] + X[j][i+1] + X[j+1][i] + X[j+1][i+1]);
+				*U_p++ = 0.25*(Y[j][i] + Y[j][i+1] + Y[j+1][i] + Y[j+1][i+1]);
+			    }
+			*U_p++ = CV[k].P[j][i];
+			*U_p++ = CV[k].RHO[j][i];
+			*U_p++ = CV[k].U[j][i];
+			*U_p++ = CV[k].V[j][i];
+			*U_p++ = CV[k].E[j][i];
 		    }
+	    if(!flu_var_write(fp, U_print, n_col * n_x * n_y, n_col, "\n"))
+		exit(1);
 	    fprintf(fp, "\n");
 	}
+    free(U_print);
     fclose(fp);
 }
@@ -8,9 +8,14 @@
 #include <string.h>
 #include <math.h>
 
+#include "../include_cii/mem.h"
+
 #include "../include/var_struc.h"
 #include "../include/tools.h"
 #include "../include/file_io.h"
+#ifdef VTUZLIB
+#include "zlib.h"
+#endif
 
 
 /**
@@ -33,8 +38,116 @@
 	fprintf(fp,"\n");			\
     } while (0)
 
+/**
+ * @brief This function returns a FNV-1a hash of the grid node coordinates and the connectivity to detect the grid change.
+ * @param[in] mv: Structure of meshing variable data.
+ * @return Hash value of the coordinates and the connectivity.
+ */
+static unsigned long long grid_hash(const struct mesh_var * mv)
+{
+    const int num_cell = (int)config[3];
+    unsigned long long h = hash_fnv1a(HASH_FNV1A_INIT, mv->X, mv->num_pt * sizeof(double));
+    h = hash_fnv1a(h, mv->Y, mv->num_pt * sizeof(double));
+    for(int k = 0; k < num_cell; k++)
+	h = hash_fnv1a(h, mv->cell_pt[k], (mv->cell_pt[k][0] + 1) * sizeof(int));
+    return h;
+}
+
+/**
+ * @brief This function write the Tecplot zone header of the unstructured grid.
+ * @param[in] fp: The pointer to the output file.
+ * @param[in] mv: Structure of meshing variable data.
+ * @param[in] cell_type: Number of nodes in each grid cell.
+ * @return Whether the grid cell type is supported.
+ */
+static int tec_zone_head(FILE * fp, const struct mesh_var * mv, const int cell_type)
+{
+    fprintf(fp, "NODES=%d, ELEMENTS=%d, DATAPACKING=BLOCK, ", mv->num_pt, (int)config[3]);
+    if (cell_type == 3)
+	fprintf(fp, "ZONETYPE=FETRIANGLE\n");
+    else if (cell_type == 4)
+	fprintf(fp, "ZONETYPE=FEQUADRILATERAL\n");
+    else
+	{
+	    printf("NON ZONETYPE!");
+	    return 0;
+	}
+    return 1;
+}
+
+/**
+ * @brief This function write the connectivity of the unstructured grid into Tecplot output.
+ * @param[in] fp: The pointer to the output file.
+ * @param[in] mv: Structure of meshing variable data.
+ * @param[in] cell_type: Number of nodes in each grid cell.
+ */
+static void tec_connectivity(FILE * fp, const struct mesh_var * mv, const int cell_type)
+{
+    const int num_cell = (int)config[3];
+    for(int k = 0; k < num_cell; k++)
+	{
+	    for(int i = 1; i <= cell_type; i++)
+		{
+		    if (i <= mv->cell_pt[k][0])
+			fprintf(fp, "\t%d", mv->cell_pt[k][i]+1);
+		    else
+			fprintf(fp, "\t%d", mv->cell_pt[k][mv->cell_pt[k][0]]+1);
+		}
+	    fprintf(fp, "\n");
+	}
+}
+
+/**
+ * @brief This function write the grid coordinates and connectivity into a Tecplot grid file 'GRID_*.tec'
+ *        if the grid has changed since the last call.
+ * @param[in] mv: Structure of meshing variable data.
+ * @param[in] add_out: Folder path of the output files.
+ * @param[in] time: The plotting time.
+ * @param[in] cell_type: Number of nodes in each grid cell.
+ */
+static void tec_grid_write(const struct mesh_var mv, const char * add_out, const double time, const int cell_type)
+{
+    const double eps = config[4];
+    static unsigned long long hash_last = 0;
+    static char add_last[FILENAME_MAX] = "";
+    unsigned long long hash = grid_hash(&mv);
+    if (hash == hash_last && strcmp(add_out, add_last) == 0)
+	return;
+
+    char file_data[FILENAME_MAX], str_tmp[40];
+    FILE * fp;
+    int k;
+    strcpy(file_data, add_out);
+    sprintf(str_tmp, "GRID_%.8g.tec", time + eps);
+    strcat(file_data, str_tmp);
+    if ((fp = fopen(file_data, "w")) == NULL)
+	{
+	    fprintf(stderr, "Cannot open grid output Tecplot file!\n");
+	    exit(1);
+	}
+    fprintf(fp, "TITLE = \"FE-Volume Brick Grid\"\n");
+    fprintf(fp, "FILETYPE = GRID\n");
+    fprintf(fp, "VARIABLES = \"X\", \"Y\"\n");
+    fprintf(fp, "ZONE T=\"Fluid Region\"\n");
+    if (!tec_zone_head(fp, &mv, cell_type))
+	{
+	    fclose(fp);
+	    remove(file_data);
+	    exit(2);
+	}
+    PRINT_NP(X);
+    PRINT_NP(Y);
+    tec_connectivity(fp, &mv, cell_type);
+    fclose(fp);
+
+    hash_last = hash;
+    strcpy(add_last, add_out);
+}
+
 /**
  * @brief This function write the 2-D solution into Tecplot output '.tec' files with unstructured block data.
+ * @details If config[35] is true, the grid is written into 'GRID_*.tec' only once per grid change,
+ *          and the solution files only contain the fluid variables.
  * @param[in] FV: Structure of fluid variable data array in computational grid.
  * @param[in] mv: Structure of meshing variable data.
  * @param[in] problem: Name of the numerical results for the test problem.
@@ -44,6 +157,7 @@ void file_write_2D_BLOCK_TEC(const struct flu_var FV, const struct mesh_var mv,
 {
     const double eps = config[4];
     const int num_cell = (int)config[3];
+    const _Bool grid_once = (_Bool)config[35];
 
     int k, num_data;
     int cell_type = 0;
@@ -52,6 +166,8 @@ void file_write_2D_BLOCK_TEC(const struct flu_var FV, const struct mesh_var mv,
   
     char file_data[FILENAME_MAX];	
     example_io(problem, file_data, 0);
+    if (grid_once)
+	tec_grid_write(mv, file_data, time, cell_type);
 
     FILE * fp;
     char str_tmp[40];
@@ -66,10 +182,19 @@ void file_write_2D_BLOCK_TEC(const struct flu_var FV, const struct mesh_var mv,
 		}
   
 	fprintf(fp, "TITLE = \"FE-Volume Brick Data\"\n");
-	fprintf(fp, "VARIABLES = \"X\", \"Y\"");
-	num_data  = 2;
-	fprintf(fp, ", \"P\", \"RHO\", \"U\", \"V\"");
-	num_data += 4;
+	if (grid_once)
+		{
+			fprintf(fp, "FILETYPE = SOLUTION\n");
+			fprintf(fp, "VARIABLES = \"P\", \"RHO\", \"U\", \"V\"");
+			num_data  = 4;
+		}
+	else
+		{
+			fprintf(fp, "VARIABLES = \"X\", \"Y\"");
+			num_data  = 2;
+			fprintf(fp, ", \"P\", \"RHO\", \"U\", \"V\"");
+			num_data += 4;
+		}
 	// internal energy
 	// fprintf(fp, ", \"e\"");
 	// num_data += 1;
@@ -90,24 +215,20 @@ void file_write_2D_BLOCK_TEC(const struct flu_var FV, const struct mesh_var mv,
 	fprintf(fp, "\n");
 					
 	fprintf(fp, "ZONE T=\"Fluid Region\", SOLUTIONTIME=%.8g \n", time + eps);
-	fprintf(fp, "NODES=%d, ELEMENTS=%d, DATAPACKING=BLOCK, ", mv.num_pt, num_cell);
-	
-	if (cell_type == 3)
-		fprintf(fp, "ZONETYPE=FETRIANGLE\n");
-	else if (cell_type == 4)
-		fprintf(fp, "ZONETYPE=FEQUADRILATERAL\n");
-	else
+	if (!tec_zone_head(fp, &mv, cell_type))
 		{
-			printf("NON ZONETYPE!");
 			fclose(fp);
 			remove(file_data);
 			exit(2);
 		}
 
-	fprintf(fp, "VARLOCATION=([%d-%d]=CELLCENTERED)\n", 3, num_data);
+	fprintf(fp, "VARLOCATION=([%d-%d]=CELLCENTERED)\n", grid_once ? 1 : 3, num_data);
 
-	PRINT_NP(X);
-	PRINT_NP(Y);
+	if (!grid_once)
+		{
+			PRINT_NP(X);
+			PRINT_NP(Y);
+		}
 	PRINT_NC(FV.P[k]);
 	PRINT_NC(FV.RHO[k]);
 	PRINT_NC(FV.U[k]);
@@ -129,17 +250,8 @@ void file_write_2D_BLOCK_TEC(const struct flu_var FV, const struct mesh_var mv,
 #endif
 #endif
 	
-	for(k = 0; k < num_cell; k++)
-		{
-			for(int i = 1; i <= cell_type; i++)
-				{
-					if (i <= mv.cell_pt[k][0])
-						fprintf(fp, "\t%d", mv.cell_pt[k][i]+1);
-					else
-						fprintf(fp, "\t%d", mv.cell_pt[k][mv.cell_pt[k][0]]+1);
-				}
-			fprintf(fp, "\n");
-		}
+	if (!grid_once)
+		tec_connectivity(fp, &mv, cell_type);
 
 	fclose(fp);
 }
@@ -238,3 +350,306 @@ void file_write_3D_VTK(const struct flu_var FV, const struct mesh_var mv, const
 
 	fclose(fp);
 }
+
+
+/**
+ * @brief Encoded geometry and topology data blocks of the VTU output, which are only encoded once per mesh.
+ */
+static struct {
+    unsigned long long hash; //!< Hash of the node coordinates and the connectivity the blocks were encoded from.
+    int num_pt, num_cell;
+    int compress;         //!< Whether the blocks are zlib compressed.
+    unsigned char * blk;  //!< Encoded blocks of points, connectivity, offsets and types.
+    size_t len[4];        //!< Byte length of each encoded block.
+} vtu_geo = {0, 0, 0, 0, NULL, {0, 0, 0, 0}};
+
+/**
+ * @brief Time series of VTU files referenced by the '.pvd' collection file.
+ */
+static struct {
+    int n, n_max;
+    double * time;
+} vtu_pvd = {0, 0, NULL};
+
+
+/**
+ * @brief This function encodes a data array into an appended data block of VTU file.
+ * @details The block consists of a UInt64 header with the byte length of the data followed by the raw data.
+ *          With zlib compression, the header is [1, nbytes, nbytes, compressed bytes] followed by the compressed data.
+ * @param[out] buf:      Buffer of the encoded block, NULL to return the length of the block only.
+ * @param[in]  data:     Data array.
+ * @param[in]  nbytes:   Byte length of the data array.
+ * @param[in]  compress: Whether to compress the data by zlib.
+ * @return Byte length of the encoded block.
+ */
+static size_t vtu_block_encode(unsigned char * buf, const void * data, const size_t nbytes, const int compress)
+{
+    unsigned long long head[4] = {1, nbytes, nbytes, 0};
+#ifdef VTUZLIB
+    if (compress)
+	{
+	    uLongf clen = compressBound((uLong)nbytes);
+	    if (buf == NULL)
+		return 4*sizeof(head[0]) + (size_t)clen;
+	    if (compress2(buf + sizeof(head), &clen, (const Bytef *)data, (uLong)nbytes, Z_BEST_SPEED) != Z_OK)
+		{
+		    fprintf(stderr, "Data compression error in VTU output!\n");
+		    exit(2);
+		}
+	    head[3] = clen;
+	    memcpy(buf, head, sizeof(head));
+	    return sizeof(head) + (size_t)clen;
+	}
+#endif
+    if (buf != NULL)
+	{
+	    memcpy(buf, head+1, sizeof(head[0]));
+	    memcpy(buf + sizeof(head[0]), data, nbytes);
+	}
+    return sizeof(head[0]) + nbytes;
+}
+
+/**
+ * @brief This function encodes the geometry and topology of the mesh into the cache 'vtu_geo' if the mesh changes.
+ * @details The cache is keyed on the hash of the node coordinates and the connectivity,
+ *          so a moved mesh or a mesh reallocated at the same address is encoded again.
+ * @param[in] mv:       Structure of meshing variable data.
+ * @param[in] compress: Whether to compress the data by zlib.
+ */
+static void vtu_geo_encode(const struct mesh_var * mv, const int compress)
+{
+    const int num_cell = (int)config[3];
+    int k, i, size = 0;
+    const unsigned long long hash = grid_hash(mv);
+    if (vtu_geo.blk != NULL && vtu_geo.hash == hash && vtu_geo.num_pt == mv->num_pt &&
+	vtu_geo.num_cell == num_cell && vtu_geo.compress == compress)
+	return;
+
+    for(k = 0; k < num_cell; k++)
+	size += mv->cell_pt[k][0];
+
+    double * pts = (double *)ALLOC_TAG(3 * mv->num_pt * sizeof(double), "output buffers");
+    int    * con = (int    *)ALLOC_TAG(size * sizeof(int), "output buffers");
+    int    * off = (int    *)ALLOC_TAG(num_cell * sizeof(int), "output buffers");
+    unsigned char * typ = (unsigned char *)ALLOC_TAG(num_cell, "output buffers");
+    for(k = 0; k < mv->num_pt; k++)
+	{
+	    pts[3*k]   = mv->X[k];
+	    pts[3*k+1] = mv->Y[k];
+	    pts[3*k+2] = 0.0;
+	}
+    size = 0;
+    for(k = 0; k < num_cell; k++)
+	{
+	    for(i = 1; i <= mv->cell_pt[k][0]; i++)
+		con[size++] = mv->cell_pt[k][i];
+	    off[k] = size;
+	    typ[k] = 7; // VTK_POLYGON
+	}
+
+    const void * data[4] = {pts, con, off, typ};
+    const size_t nbytes[4] = {3 * mv->num_pt * sizeof(double), size * sizeof(int), num_cell * sizeof(int), (size_t)num_cell};
+    size_t len_max = 0;
+    for(i = 0; i < 4; i++)
+	len_max += vtu_block_encode(NULL, data[i], nbytes[i], compress);
+    FREE(vtu_geo.blk);
+    vtu_geo.blk = (unsigned char *)ALLOC_TAG(len_max, "output buffers");
+    len_max = 0;
+    for(i = 0; i < 4; i++)
+	{
+	    vtu_geo.len[i] = vtu_block_encode(vtu_geo.blk + len_max, data[i], nbytes[i], compress);
+	    len_max += vtu_geo.len[i];
+	}
+    vtu_geo.hash     = hash;
+    vtu_geo.num_pt   = mv->num_pt;
+    vtu_geo.num_cell = num_cell;
+    vtu_geo.compress = compress;
+
+    FREE(pts);
+    FREE(con);
+    FREE(off);
+    FREE(typ);
+}
+
+/**
+ * @brief This function rewrites the '.pvd' collection file with the time series of all VTU files written.
+ * @param[in] file_data: Folder path of the output files.
+ * @param[in] time:      The plotting time of the newly written VTU file.
+ */
+static void vtu_pvd_write(const char * file_data, const double time)
+{
+    const double eps = config[4];
+    int k;
+    for(k = 0; k < vtu_pvd.n; k++)
+	if (vtu_pvd.time[k] == time)
+	    break;
+    if (k == vtu_pvd.n)
+	{
+	    if (vtu_pvd.n == vtu_pvd.n_max)
+		{
+		    vtu_pvd.n_max = vtu_pvd.n_max ? 2*vtu_pvd.n_max : 16;
+		    vtu_pvd.time  = (double *)realloc(vtu_pvd.time, vtu_pvd.n_max * sizeof(double));
+		    if (vtu_pvd.time == NULL)
+			{
+			    fprintf(stderr, "Not enough memory in PVD output!\n");
+			    exit(5);
+			}
+		}
+	    vtu_pvd.time[vtu_pvd.n++] = time;
+	}
+
+    char file_pvd[FILENAME_MAX];
+    strcpy(file_pvd, file_data);
+    strcat(file_pvd, "FLU_VAR.pvd");
+    FILE * fp;
+    if ((fp = fopen(file_pvd, "w")) == NULL)
+	{
+	    fprintf(stderr, "Cannot open PVD collection output file!\n");
+	    exit(1);
+	}
+    fprintf(fp, "<?xml version=\"1.0\"?>\n");
+    fprintf(fp, "<VTKFile type=\"Collection\" version=\"1.0\">\n");
+    fprintf(fp, "  <Collection>\n");
+    for(k = 0; k < vtu_pvd.n; k++)
+	fprintf(fp, "    <DataSet timestep=\"%.10g\" file=\"FLU_VAR_%.8g.vtu\"/>\n", vtu_pvd.time[k], vtu_pvd.time[k] + eps);
+    fprintf(fp, "  </Collection>\n");
+    fprintf(fp, "</VTKFile>\n");
+    fclose(fp);
+}
+
+
+/**
+ * @brief Encode the cell data array 'v' with 'n_comp' components into the next appended data block.
+ */
+#define VTU_ENCODE_SCA(name, v, n_comp)					\
+    do {								\
+	blk_name[n_blk] = (name);					\
+	blk_comp[n_blk] = (n_comp);					\
+	blk_len[n_blk]  = vtu_block_encode(blk + len_all, (v), (n_comp) * num_cell * sizeof(double), compress); \
+	len_all += blk_len[n_blk++];					\
+    } while (0)
+
+/**
+ * @brief This function write the 2-D solution into XML VTK output '.vtu' files with appended raw binary data.
+ * @details The geometry and topology are encoded once and cached while the mesh is unchanged,
+ *          so only the fluid variables are encoded for each snapshot.
+ *          A '.pvd' collection file references all the VTU files as a time series.
+ *          - config[34] = 1: uncompressed appended raw binary data.
+ *          - config[34] = 2: zlib compressed appended binary data (precompiled macro VTUZLIB needed).
+ * @param[in] FV: Structure of fluid variable data array in computational grid.
+ * @param[in] mv: Structure of meshing variable data.
+ * @param[in] problem: Name of the numerical results for the test problem.
+ * @param[in] time: The plotting time.
+ */
+void file_write_2D_VTU(const struct flu_var FV, const struct mesh_var mv, const char * problem, const double time)
+{
+    const double eps = config[4];
+    const int num_cell = (int)config[3];
+#ifdef VTUZLIB
+    const int compress = (int)config[34] == 2;
+#else
+    const int compress = 0;
+#endif
+
+    char file_data[FILENAME_MAX], file_vtu[FILENAME_MAX];
+    example_io(problem, file_data, 0);
+
+    vtu_geo_encode(&mv, compress);
+
+    //===================Encode fluid variables======================
+    const char * blk_name[10];
+    int    blk_comp[10], n_blk = 0, k;
+    size_t blk_len[10], len_all = 0;
+    unsigned char * blk = (unsigned char *)ALLOC_TAG(10 * vtu_block_encode(NULL, NULL, 3 * num_cell * sizeof(double), compress), "output buffers");
+    double * vel = (double *)ALLOC_TAG(3 * num_cell * sizeof(double), "output buffers");
+    VTU_ENCODE_SCA("P",   FV.P,   1);
+    VTU_ENCODE_SCA("RHO", FV.RHO, 1);
+#ifdef MULTIFLUID_BASICS
+    VTU_ENCODE_SCA("Z_a", FV.Z_a, 1);
+#ifdef MULTIPHASE_BASICS
+    VTU_ENCODE_SCA("P_b",   FV.P_b,   1);
+    VTU_ENCODE_SCA("RHO_b", FV.RHO_b, 1);
+    VTU_ENCODE_SCA("U_b",   FV.U_b,   1);
+    VTU_ENCODE_SCA("V_b",   FV.V_b,   1);
+#else
+    VTU_ENCODE_SCA("PHI",   FV.PHI,   1);
+    VTU_ENCODE_SCA("gamma", FV.gamma, 1);
+#endif
+#endif
+    for(k = 0; k < num_cell; k++)
+	{
+	    vel[3*k]   = FV.U[k];
+	    vel[3*k+1] = FV.V[k];
+	    vel[3*k+2] = 0.0;
+	}
+    VTU_ENCODE_SCA("velocity", vel, 3);
+    FREE(vel);
+
+    //===================Write solution File=========================
+    FILE * fp;
+    char str_tmp[40];
+    size_t offset = 0;
+
+    sprintf(str_tmp, "FLU_VAR_%.8g.vtu", time + eps);
+    strcpy(file_vtu, file_data);
+    strcat(file_vtu, str_tmp);
+    if ((fp = fopen(file_vtu, "wb")) == NULL)
+	{
+	    fprintf(stderr, "Cannot open solution output VTU file!\n");
+	    exit(1);
+	}
+
+    const union { unsigned short s; unsigned char c; } endian = {1};
+    fprintf(fp, "<?xml version=\"1.0\"?>\n");
+    fprintf(fp, "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"%s\" header_type=\"UInt64\"%s>\n",
+	    endian.c ? "LittleEndian" : "BigEndian", compress ? " compressor=\"vtkZLibDataCompressor\"" : "");
+    fprintf(fp, "  <UnstructuredGrid>\n");
+    fprintf(fp, "    <FieldData>\n");
+    fprintf(fp, "      <DataArray type=\"Float64\" Name=\"TimeValue\" NumberOfTuples=\"1\" format=\"ascii\">%.10g</DataArray>\n", time);
+    fprintf(fp, "    </FieldData>\n");
+    fprintf(fp, "    <Piece NumberOfPoints=\"%d\" NumberOfCells=\"%d\">\n", mv.num_pt, num_cell);
+    fprintf(fp, "      <CellData Scalars=\"P\" Vectors=\"velocity\">\n");
+    for(k = 0; k < n_blk; k++)
+	{
+	    fprintf(fp, "        <DataArray type=\"Float64\" Name=\"%s\" NumberOfComponents=\"%d\" format=\"appended\" offset=\"%zu\"/>\n",
+		    blk_name[k], blk_comp[k], offset);
+	    offset += blk_len[k];
+	}
+    fprintf(fp, "      </CellData>\n");
+    fprintf(fp, "      <Points>\n");
+    fprintf(fp, "        <DataArray type=\"Float64\" NumberOfComponents=\"3\" format=\"appended\" offset=\"%zu\"/>\n", offset);
+    offset += vtu_geo.len[0];
+    fprintf(fp, "      </Points>\n");
+    fprintf(fp, "      <Cells>\n");
+    fprintf(fp, "        <DataArray type=\"Int%zu\" Name=\"connectivity\" format=\"appended\" offset=\"%zu\"/>\n", 8*sizeof(int), offset);
+    offset += vtu_geo.len[1];
+    fprintf(fp, "        <DataArray type=\"Int%zu\" Name=\"offsets\" format=\"appended\" offset=\"%zu\"/>\n", 8*sizeof(int), offset);
+    offset += vtu_geo.len[2];
+    fprintf(fp, "        <DataArray type=\"UInt8\" Name=\"types\" format=\"appended\" offset=\"%zu\"/>\n", offset);
+    fprintf(fp, "      </Cells>\n");
+    fprintf(fp, "    </Piece>\n");
+    fprintf(fp, "  </UnstructuredGrid>\n");
+    fprintf(fp, "  <AppendedData encoding=\"raw\">\n_");
+    fwrite(blk, 1, len_all, fp);
+    fwrite(vtu_geo.blk, 1, vtu_geo.len[0] + vtu_geo.len[1] + vtu_geo.len[2] + vtu_geo.len[3], fp);
+    fprintf(fp, "\n  </AppendedData>\n");
+    fprintf(fp, "</VTKFile>\n");
+    fclose(fp);
+    FREE(blk);
+
+    vtu_pvd_write(file_data, time);
+}
+
+/**
+ * @brief This function frees the cached geometry blocks and the '.pvd' time series of the VTU output.
+ * @details It is called once the last VTU file of the mesh has been written.
+ */
+void file_write_2D_VTU_free(void)
+{
+    FREE(vtu_geo.blk);
+    vtu_geo.hash = 0;
+    vtu_geo.num_pt = vtu_geo.num_cell = vtu_geo.compress = 0;
+    free(vtu_pvd.time);
+    vtu_pvd.time = NULL;
+    vtu_pvd.n = vtu_pvd.n_max = 0;
+}
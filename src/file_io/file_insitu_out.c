@@ -0,0 +1,578 @@
+/**
+ * @file  file_insitu_out.c
+ * @brief This is a set of functions which compute in-situ analysis of two-dimensional data in the time loop
+ *        and write them as compact time series.
+ * @details The analysis is activated by 'config[36]' (output interval in time steps).
+ *          Point probes and line cuts are read from the file 'insitu.txt' (or 'insitu.dat')
+ *          in the initial data folder of the test example, one per line:
+ *          - probe x y
+ *          - cut   x_0 y_0 x_1 y_1 n
+ *
+ *          A line that doesn't begin with these keywords is a comment.
+ *          The following files are written in the output data folder:
+ *          - 'insitu_sum.dat':   integrated conserved quantities, min/max/norms and mixing width of fluid a;
+ *          - 'insitu_probe.dat': primitive variables at point probes;
+ *          - 'insitu_cut.dat':   primitive variables on the n points of line cuts, one block per cut and time.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdbool.h>
+#include <float.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "../include/var_struc.h"
+#include "../include/tools.h"
+#include "../include/file_io.h"
+
+
+//! Number of integrated and extremal quantities without the mixing width.
+#define N_SUM 14
+
+//! Sampling POINT of probes and line cuts with interpolation weights on up to four grid cells.
+struct insitu_pt {
+    double x, y;
+    int    cell[4];
+    double w[4];
+};
+
+//! State of the in-situ analysis.
+static struct {
+    _Bool read;              //!< Whether the setup file has been read.
+    int n_probe, n_cut;      //!< Number of point probes and line cuts.
+    int n_pt;                //!< Total number of sampling points.
+    int * cut_n;             //!< Number of sampling points on each line cut.
+    struct insitu_pt * pt;   //!< Sampling points of probes followed by points of line cuts.
+    int grid_n[2];           //!< Size of the grid on which sampling points are located.
+    unsigned long long grid_hash; //!< Hash of the grid on which sampling points are located.
+    double * X_c, * Y_c;     //!< Cell centers of the located unstructured grid.
+    double L_x;              //!< Length of the unstructured computational domain in x direction.
+    char problem[FILENAME_MAX]; //!< Name of the numerical results whose files have been started.
+    char add_out[FILENAME_MAX+40];
+} insitu;
+
+
+/**
+ * @brief This function reads the setup file of the in-situ analysis 'insitu.txt'.
+ * @param[in] add_in: Adress of the initial data folder of the test example.
+ */
+static void insitu_read(const char * add_in)
+{
+    char add[FILENAME_MAX+40], one_line[200], key[10];
+    double x0, y0, x1, y1;
+    int n, k, l;
+    FILE * fp;
+
+    insitu.read = true;
+    strcpy(add, add_in);
+    strcat(add, "insitu.txt");
+    if((fp = fopen(add, "r")) == NULL)
+	{
+	    strcpy(add, add_in);
+	    strcat(add, "insitu.dat");
+	    if((fp = fopen(add, "r")) == NULL)
+		{
+		    printf("No in-situ analysis setup file! Only the integrated quantities will be written.\n");
+		    return;
+		}
+	}
+    // Count probes and points on line cuts, then store them with points on line cuts behind probes.
+    int n_pt_cut = 0;
+    for(l = 0; l < 2; l++)
+	{
+	    insitu.n_probe = insitu.n_cut = n_pt_cut = 0;
+	    while (fgets(one_line, sizeof(one_line), fp) != NULL)
+		{
+		    if (sscanf(one_line, "%9s", key) != 1)
+			continue;
+		    if (strcmp(key, "probe") == 0 && sscanf(one_line, "%*s %lf %lf", &x0, &y0) == 2)
+			{
+			    if (l)
+				{
+				    insitu.pt[insitu.n_probe].x = x0;
+				    insitu.pt[insitu.n_probe].y = y0;
+				}
+			    insitu.n_probe++;
+			}
+		    else if (strcmp(key, "cut") == 0 && sscanf(one_line, "%*s %lf %lf %lf %lf %d", &x0, &y0, &x1, &y1, &n) == 5 && n > 0)
+			{
+			    if (l)
+				{
+				    insitu.cut_n[insitu.n_cut] = n;
+				    for(k = 0; k < n; k++)
+					{
+					    insitu.pt[insitu.n_pt + n_pt_cut + k].x = n > 1 ? x0 + (x1-x0)*k/(n-1) : x0;
+					    insitu.pt[insitu.n_pt + n_pt_cut + k].y = n > 1 ? y0 + (y1-y0)*k/(n-1) : y0;
+					}
+				}
+			    insitu.n_cut++;
+			    n_pt_cut += n;
+			}
+		}
+	    if (l == 0)
+		{
+		    insitu.n_pt  = insitu.n_probe;
+		    insitu.cut_n = (int *)malloc((insitu.n_cut + 1) * sizeof(int));
+		    insitu.pt    = (struct insitu_pt *)malloc((insitu.n_probe + n_pt_cut + 1) * sizeof(struct insitu_pt));
+		    if(insitu.cut_n == NULL || insitu.pt == NULL)
+			{
+			    fprintf(stderr, "Not enough memory in in-situ analysis setup!\n");
+			    fclose(fp);
+			    exit(5);
+			}
+		    rewind(fp);
+		}
+	}
+    insitu.n_pt += n_pt_cut;
+    fclose(fp);
+    printf("Load in-situ analysis setup file with %d probes and %d line cuts.\n", insitu.n_probe, insitu.n_cut);
+}
+
+/**
+ * @brief This function initializes the in-situ analysis before the time loop.
+ * @param[in] name: Name of the test example.
+ */
+void insitu_init(const char * name)
+{
+    if (!(int)config[36] || insitu.read)
+	return;
+    char add_in[FILENAME_MAX+40];
+    example_io(name, add_in, 1);
+    insitu_read(add_in);
+}
+
+/**
+ * @brief This function opens the output file of the in-situ analysis.
+ * @details The file is created with a header line at the first output of the numerical results,
+ *          and is appended afterwards.
+ * @param[in] file:   Name of the output file.
+ * @param[in] header: Header line of the output file.
+ * @param[in] start:  Whether to create the file at the first output.
+ * @return The pointer to the output file.
+ */
+static FILE * insitu_open(const char * file, const char * header, const _Bool start)
+{
+    char file_data[FILENAME_MAX+80];
+    FILE * fp;
+    strcpy(file_data, insitu.add_out);
+    strcat(file_data, file);
+    if ((fp = fopen(file_data, start ? "w" : "a")) == NULL)
+	{
+	    fprintf(stderr, "Cannot open in-situ analysis output file '%s'!\n", file);
+	    exit(1);
+	}
+    if (start)
+	fprintf(fp, "%s\n", header);
+    return fp;
+}
+
+/**
+ * @brief This function writes the in-situ analysis at one time step.
+ * @param[in] problem: Name of the numerical results for the test problem.
+ * @param[in] step:    Number of the time step.
+ * @param[in] time:    Current time.
+ * @param[in] sum:     Array of integrated and extremal quantities.
+ * @param[in] n_sum:   Number of the integrated and extremal quantities.
+ * @param[in] val:     Array of primitive variables on sampling points.
+ * @param[in] n_var:   Number of primitive variables on each sampling point.
+ */
+static void insitu_output(const char * problem, const int step, const double time,
+			  const double * sum, const int n_sum, const double * val, const int n_var)
+{
+    const _Bool start = strcmp(insitu.problem, problem) != 0;
+    const char * var_name = n_var > 4 ? "RHO\tU\tV\tP\tZ_a" : "RHO\tU\tV\tP";
+    char header[400];
+    FILE * fp;
+    int k, l;
+
+    if (start)
+	{
+	    strncpy(insitu.problem, problem, sizeof(insitu.problem) - 1);
+	    example_io(problem, insitu.add_out, 0);
+	}
+
+    sprintf(header, "# step\ttime\tmass\tmom_x\tmom_y\tenergy\trho_min\trho_max\tp_min\tp_max\t"
+	    "rho_L1\trho_L2\tp_L1\tp_L2\tspeed_max\tvol%s", n_sum > N_SUM ? "\tmix_width\tmix_x_min\tmix_x_max" : "");
+    fp = insitu_open("insitu_sum.dat", header, start);
+    fprintf(fp, "%d\t%.10g\t", step, time);
+    flu_var_write(fp, sum, n_sum, n_sum, "\n");
+    fclose(fp);
+
+    if (insitu.n_probe)
+	{
+	    sprintf(header, "# step\ttime\t(%s) on each probe", var_name);
+	    fp = insitu_open("insitu_probe.dat", header, start);
+	    fprintf(fp, "%d\t%.10g\t", step, time);
+	    flu_var_write(fp, val, n_var*insitu.n_probe, n_var*insitu.n_probe, "\n");
+	    fclose(fp);
+	}
+
+    if (insitu.n_cut)
+	{
+	    sprintf(header, "# x\ty\t%s", var_name);
+	    fp = insitu_open("insitu_cut.dat", header, start);
+	    l = insitu.n_probe;
+	    for(k = 0; k < insitu.n_cut; l += insitu.cut_n[k++])
+		{
+		    fprintf(fp, "# step %d, time %.10g, cut %d\n", step, time, k);
+		    for(int p = l; p < l + insitu.cut_n[k]; p++)
+			{
+			    fprintf(fp, "%.10g\t%.10g\t", insitu.pt[p].x, insitu.pt[p].y);
+			    flu_var_write(fp, val + n_var*p, n_var, n_var, "\n");
+			}
+		    fprintf(fp, "\n\n");
+		}
+	    fclose(fp);
+	}
+}
+
+/**
+ * @brief This function finds the interval [x_l, x_l+1) of point x in the ascending array 'x[]'.
+ * @param[in] x:   Array of the coordinate data.
+ * @param[in] num: Number of the coordinate data.
+ * @param[in] p:   Coordinate of the point.
+ * @return Index of the left endpoint in [0, num-2], or 0 if num < 2.
+ */
+static int interval_find(const double * x, const int num, const double p)
+{
+    int l = 0;
+    while (l < num - 2 && x[l+1] <= p)
+	l++;
+    return l;
+}
+
+/**
+ * @brief This function returns a FNV-1a hash of the node coordinates of the structured grid.
+ * @param[in] n_x: Number of the x-grids.
+ * @param[in] n_y: Number of the y-grids.
+ * @param[in] X:   Array of the x-coordinate data of grid nodes.
+ * @param[in] Y:   Array of the y-coordinate data of grid nodes.
+ * @return Hash value of the coordinates.
+ */
+static unsigned long long insitu_hash_stru(const int n_x, const int n_y, double ** X, double ** Y)
+{
+    unsigned long long h = HASH_FNV1A_INIT;
+    for(int j = 0; j <= n_x; j++)
+	{
+	    h = hash_fnv1a(h, X[j], (n_y+1) * sizeof(double));
+	    h = hash_fnv1a(h, Y[j], (n_y+1) * sizeof(double));
+	}
+    return h;
+}
+
+/**
+ * @brief This function locates the sampling points on the structured grid.
+ * @details If 'config[37]' is true, the variables are interpolated bilinearly between the four nearest
+ *          cell centers, otherwise the values in the cell containing the point are taken.
+ * @param[in] n_x: Number of the x-grids.
+ * @param[in] n_y: Number of the y-grids.
+ * @param[in] X:   Array of the x-coordinate data of grid nodes.
+ * @param[in] Y:   Array of the y-coordinate data of grid nodes.
+ */
+static void insitu_locate_stru(const int n_x, const int n_y, double ** X, double ** Y)
+{
+    const _Bool bilinear = (_Bool)config[37];
+    double * x = (double *)malloc((n_x + n_y + 2) * sizeof(double)), * y = x + n_x + 1;
+    double s, t;
+    int p, j, i;
+    if(x == NULL)
+	{
+	    fprintf(stderr, "Not enough memory in in-situ analysis locating!\n");
+	    exit(5);
+	}
+    // Nodes for cell lookup, cell centers for bilinear interpolation.
+    for(j = 0; j <= n_x; j++)
+	x[j] = bilinear ? (j < n_x ? 0.5*(X[j][0] + X[j+1][0]) : 0.0) : X[j][0];
+    for(i = 0; i <= n_y; i++)
+	y[i] = bilinear ? (i < n_y ? 0.5*(Y[0][i] + Y[0][i+1]) : 0.0) : Y[0][i];
+
+    for(p = 0; p < insitu.n_pt; p++)
+	{
+	    struct insitu_pt * pt = insitu.pt + p;
+	    if (!bilinear)
+		{
+		    j = interval_find(x, n_x + 1, pt->x);
+		    i = interval_find(y, n_y + 1, pt->y);
+		    pt->cell[0] = pt->cell[1] = pt->cell[2] = pt->cell[3] = j*n_y + i;
+		    pt->w[0] = 1.0;
+		    pt->w[1] = pt->w[2] = pt->w[3] = 0.0;
+		    continue;
+		}
+	    j = interval_find(x, n_x, pt->x);
+	    i = interval_find(y, n_y, pt->y);
+	    s = n_x > 1 ? fmin(fmax((pt->x - x[j]) / (x[j+1] - x[j]), 0.0), 1.0) : 0.0;
+	    t = n_y > 1 ? fmin(fmax((pt->y - y[i]) / (y[i+1] - y[i]), 0.0), 1.0) : 0.0;
+	    pt->cell[0] = j*n_y + i;
+	    pt->cell[1] = n_x > 1 ? pt->cell[0] + n_y : pt->cell[0];
+	    pt->cell[2] = n_y > 1 ? pt->cell[0] + 1   : pt->cell[0];
+	    pt->cell[3] = n_y > 1 ? pt->cell[1] + 1   : pt->cell[1];
+	    pt->w[0] = (1.0-s)*(1.0-t);
+	    pt->w[1] =      s *(1.0-t);
+	    pt->w[2] = (1.0-s)*     t;
+	    pt->w[3] =      s *     t;
+	}
+    free(x);
+}
+
+/**
+ * @brief This function computes in-situ analysis on 2-D structured grids and writes them every 'config[36]' time steps.
+ * @param[in] n_x:     Number of the x-grids.
+ * @param[in] n_y:     Number of the y-grids.
+ * @param[in] CV:      Structure of cell variable data at current time.
+ * @param[in] X:       Array of the x-coordinate data of grid nodes.
+ * @param[in] Y:       Array of the y-coordinate data of grid nodes.
+ * @param[in] problem: Name of the numerical results for the test problem.
+ * @param[in] step:    Number of the time step.
+ * @param[in] time:    Current time.
+ * @param[in] last:    Whether to write at the last time step regardless of the interval.
+ */
+void insitu_2D_stru(const int n_x, const int n_y, const struct cell_var_stru * CV, double ** X, double ** Y,
+		    const char * problem, const int step, const double time, const _Bool last)
+{
+    const int interval = (int)config[36];
+    if (interval <= 0 || (!last && step % interval))
+	return;
+    const unsigned long long hash = insitu_hash_stru(n_x, n_y, X, Y);
+    if (insitu.grid_n[0] != n_x || insitu.grid_n[1] != n_y || insitu.grid_hash != hash)
+	{
+	    insitu_locate_stru(n_x, n_y, X, Y);
+	    insitu.grid_n[0]  = n_x;
+	    insitu.grid_n[1]  = n_y;
+	    insitu.grid_hash = hash;
+	}
+
+    double mass = 0.0, mom_x = 0.0, mom_y = 0.0, ene = 0.0, vol = 0.0;
+    double rho_min = DBL_MAX, rho_max = -DBL_MAX, p_min = DBL_MAX, p_max = -DBL_MAX;
+    double rho_L1 = 0.0, rho_L2 = 0.0, p_L1 = 0.0, p_L2 = 0.0, speed_max = 0.0;
+    double dV, q;
+    int i, j, p, l;
+
+#ifdef _OPENMP
+#pragma omp parallel for private(dV, q) collapse(2) reduction(+:mass, mom_x, mom_y, ene, vol, rho_L1, rho_L2, p_L1, p_L2) \
+    reduction(min:rho_min, p_min) reduction(max:rho_max, p_max, speed_max)
+#endif
+    for(j = 0; j < n_x; j++)
+	for(i = 0; i < n_y; i++)
+	    {
+		dV = (X[j+1][i] - X[j][i]) * (Y[j][i+1] - Y[j][i]);
+		vol   += dV;
+		mass  += CV->RHO[j][i] * dV;
+		mom_x += CV->RHO[j][i] * CV->U[j][i] * dV;
+		mom_y += CV->RHO[j][i] * CV->V[j][i] * dV;
+		ene   += CV->RHO[j][i] * CV->E[j][i] * dV;
+		rho_L1 += fabs(CV->RHO[j][i]) * dV;
+		rho_L2 += CV->RHO[j][i] * CV->RHO[j][i] * dV;
+		p_L1   += fabs(CV->P[j][i]) * dV;
+		p_L2   += CV->P[j][i] * CV->P[j][i] * dV;
+		rho_min = fmin(rho_min, CV->RHO[j][i]);
+		rho_max = fmax(rho_max, CV->RHO[j][i]);
+		p_min   = fmin(p_min,   CV->P[j][i]);
+		p_max   = fmax(p_max,   CV->P[j][i]);
+		q = CV->U[j][i]*CV->U[j][i] + CV->V[j][i]*CV->V[j][i];
+		speed_max = fmax(speed_max, q);
+	    }
+    double sum[N_SUM] = {mass, mom_x, mom_y, ene, rho_min, rho_max, p_min, p_max,
+			 rho_L1/vol, sqrt(rho_L2/vol), p_L1/vol, sqrt(p_L2/vol), sqrt(speed_max), vol};
+
+    double * val = (double *)calloc(4*insitu.n_pt + 1, sizeof(double));
+    if(val == NULL)
+	{
+	    fprintf(stderr, "Not enough memory in in-situ analysis!\n");
+	    exit(5);
+	}
+    for(p = 0; p < insitu.n_pt; p++)
+	for(l = 0; l < 4; l++)
+	    {
+		j = insitu.pt[p].cell[l] / n_y;
+		i = insitu.pt[p].cell[l] % n_y;
+		val[4*p]   += insitu.pt[p].w[l] * CV->RHO[j][i];
+		val[4*p+1] += insitu.pt[p].w[l] * CV->U[j][i];
+		val[4*p+2] += insitu.pt[p].w[l] * CV->V[j][i];
+		val[4*p+3] += insitu.pt[p].w[l] * CV->P[j][i];
+	    }
+    insitu_output(problem, step, time, sum, N_SUM, val, 4);
+    free(val);
+}
+
+/**
+ * @brief This function returns a FNV-1a hash of the node coordinates and the connectivity of the unstructured grid.
+ * @param[in] mv: Structure of meshing variable data.
+ * @return Hash value of the coordinates and the connectivity.
+ */
+static unsigned long long insitu_hash_unstruct(const struct mesh_var * mv)
+{
+    const int num_cell = (int)config[3];
+    unsigned long long h = hash_fnv1a(HASH_FNV1A_INIT, mv->X, mv->num_pt * sizeof(double));
+    h = hash_fnv1a(h, mv->Y, mv->num_pt * sizeof(double));
+    for(int k = 0; k < num_cell; k++)
+	h = hash_fnv1a(h, mv->cell_pt[k], (mv->cell_pt[k][0] + 1) * sizeof(int));
+    return h;
+}
+
+/**
+ * @brief This function locates the sampling points in the grid cells containing them on the unstructured grid.
+ * @details Points outside the computational domain take the cell with the nearest center.
+ * @param[in] mv: Structure of meshing variable data.
+ */
+static void insitu_locate_unstruct(const struct mesh_var * mv)
+{
+    const int num_cell = (int)config[3];
+    int ** cp = mv->cell_pt;
+    double x_min = DBL_MAX, x_max = -DBL_MAX, d, d_min;
+    int k, j, p, n_c;
+    _Bool in;
+
+    free(insitu.X_c);
+    insitu.X_c = (double *)malloc(2 * num_cell * sizeof(double));
+    if(insitu.X_c == NULL)
+	{
+	    fprintf(stderr, "Not enough memory in in-situ analysis locating!\n");
+	    exit(5);
+	}
+    insitu.Y_c = insitu.X_c + num_cell;
+    for(k = 0; k < num_cell; k++)
+	{
+	    insitu.X_c[k] = insitu.Y_c[k] = 0.0;
+	    for(j = 1; j <= cp[k][0]; j++)
+		{
+		    insitu.X_c[k] += mv->X[cp[k][j]] / cp[k][0];
+		    insitu.Y_c[k] += mv->Y[cp[k][j]] / cp[k][0];
+		    x_min = fmin(x_min, mv->X[cp[k][j]]);
+		    x_max = fmax(x_max, mv->X[cp[k][j]]);
+		}
+	}
+    insitu.L_x = x_max - x_min;
+
+    for(p = 0; p < insitu.n_pt; p++)
+	{
+	    struct insitu_pt * pt = insitu.pt + p;
+	    n_c = 0;
+	    d_min = DBL_MAX;
+	    for(k = 0; k < num_cell; k++)
+		{
+		    // Crossing number test of the point in polygon cell k.
+		    in = false;
+		    for(j = 1; j <= cp[k][0]; j++)
+			{
+			    const int a = cp[k][j], b = cp[k][j % cp[k][0] + 1];
+			    if ((mv->Y[a] > pt->y) != (mv->Y[b] > pt->y) &&
+				pt->x < (mv->X[b]-mv->X[a])*(pt->y-mv->Y[a])/(mv->Y[b]-mv->Y[a]) + mv->X[a])
+				in = !in;
+			}
+		    if (in)
+			{
+			    n_c = k;
+			    break;
+			}
+		    d = (insitu.X_c[k]-pt->x)*(insitu.X_c[k]-pt->x) + (insitu.Y_c[k]-pt->y)*(insitu.Y_c[k]-pt->y);
+		    if (d < d_min)
+			{
+			    d_min = d;
+			    n_c = k;
+			}
+		}
+	    pt->cell[0] = pt->cell[1] = pt->cell[2] = pt->cell[3] = n_c;
+	    pt->w[0] = 1.0;
+	    pt->w[1] = pt->w[2] = pt->w[3] = 0.0;
+	}
+}
+
+/**
+ * @brief This function computes in-situ analysis on 2-D unstructured grids and writes them every 'config[36]' time steps.
+ * @details The primitive variables are taken from the cache refreshed by 'fluid_var_update()'.
+ *          The mixing width of fluid a is W = ∫4Z_a(1-Z_a)dV/L_y with L_y = V/L_x,
+ *          and [mix_x_min, mix_x_max] is the x-range of cell centers where 0.01 < Z_a < 0.99.
+ * @param[in] cv:      Structure of cell variable data.
+ * @param[in] mv:      Structure of meshing variable data.
+ * @param[in] problem: Name of the numerical results for the test problem.
+ * @param[in] step:    Number of the time step.
+ * @param[in] time:    Current time.
+ * @param[in] last:    Whether to write at the last time step regardless of the interval.
+ */
+void insitu_2D_unstruct(const struct cell_var * cv, const struct mesh_var * mv,
+			const char * problem, const int step, const double time, const _Bool last)
+{
+    const int interval = (int)config[36];
+    if (interval <= 0 || (!last && step % interval))
+	return;
+    const int num_cell = (int)config[3];
+    const unsigned long long hash = insitu_hash_unstruct(mv);
+    if (insitu.grid_n[0] != num_cell || insitu.grid_n[1] != mv->num_pt || insitu.grid_hash != hash)
+	{
+	    insitu_locate_unstruct(mv);
+	    insitu.grid_n[0]  = num_cell;
+	    insitu.grid_n[1]  = mv->num_pt;
+	    insitu.grid_hash = hash;
+	}
+
+    double mass = 0.0, mom_x = 0.0, mom_y = 0.0, ene = 0.0, vol = 0.0;
+    double rho_min = DBL_MAX, rho_max = -DBL_MAX, p_min = DBL_MAX, p_max = -DBL_MAX;
+    double rho_L1 = 0.0, rho_L2 = 0.0, p_L1 = 0.0, p_L2 = 0.0, speed_max = 0.0;
+    double mix = 0.0, mix_x_min = DBL_MAX, mix_x_max = -DBL_MAX;
+    double dV;
+    int k, p, n_sum = N_SUM, n_var = 4;
+
+#ifdef _OPENMP
+#pragma omp parallel for private(dV) reduction(+:mass, mom_x, mom_y, ene, vol, rho_L1, rho_L2, p_L1, p_L2, mix) \
+    reduction(min:rho_min, p_min, mix_x_min) reduction(max:rho_max, p_max, speed_max, mix_x_max)
+#endif
+    for(k = 0; k < num_cell; k++)
+	{
+	    dV = cv->vol[k];
+	    vol   += dV;
+	    mass  += cv->U_rho[k] * dV;
+	    mom_x += cv->U_u[k]   * dV;
+	    mom_y += cv->U_v[k]   * dV;
+	    ene   += cv->U_e[k]   * dV;
+	    rho_L1 += fabs(cv->RHO[k]) * dV;
+	    rho_L2 += cv->RHO[k] * cv->RHO[k] * dV;
+	    p_L1   += fabs(cv->P[k]) * dV;
+	    p_L2   += cv->P[k] * cv->P[k] * dV;
+	    rho_min = fmin(rho_min, cv->RHO[k]);
+	    rho_max = fmax(rho_max, cv->RHO[k]);
+	    p_min   = fmin(p_min,   cv->P[k]);
+	    p_max   = fmax(p_max,   cv->P[k]);
+	    speed_max = fmax(speed_max, cv->U[k]*cv->U[k] + cv->V[k]*cv->V[k]);
+#ifdef MULTIFLUID_BASICS
+	    mix += 4.0 * cv->Z_a[k] * (1.0 - cv->Z_a[k]) * dV;
+	    if (cv->Z_a[k] > 0.01 && cv->Z_a[k] < 0.99)
+		{
+		    mix_x_min = fmin(mix_x_min, insitu.X_c[k]);
+		    mix_x_max = fmax(mix_x_max, insitu.X_c[k]);
+		}
+#endif
+	}
+    double sum[N_SUM + 3] = {mass, mom_x, mom_y, ene, rho_min, rho_max, p_min, p_max,
+			     rho_L1/vol, sqrt(rho_L2/vol), p_L1/vol, sqrt(p_L2/vol), sqrt(speed_max), vol,
+			     mix * insitu.L_x / vol,
+			     mix_x_min <= mix_x_max ? mix_x_min : NAN,
+			     mix_x_min <= mix_x_max ? mix_x_max : NAN};
+#ifdef MULTIFLUID_BASICS
+    n_sum += 3;
+    n_var  = 5;
+#endif
+
+    double * val = (double *)malloc((n_var*insitu.n_pt + 1) * sizeof(double));
+    if(val == NULL)
+	{
+	    fprintf(stderr, "Not enough memory in in-situ analysis!\n");
+	    exit(5);
+	}
+    for(p = 0; p < insitu.n_pt; p++)
+	{
+	    k = insitu.pt[p].cell[0];
+	    val[n_var*p]   = cv->RHO[k];
+	    val[n_var*p+1] = cv->U[k];
+	    val[n_var*p+2] = cv->V[k];
+	    val[n_var*p+3] = cv->P[k];
+#ifdef MULTIFLUID_BASICS
+	    val[n_var*p+4] = cv->Z_a[k];
+#endif
+	}
+    insitu_output(problem, step, time, sum, n_sum, val, n_var);
+    free(val);
+}
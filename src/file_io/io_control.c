@@ -13,6 +13,9 @@
 
 #include "../include/var_struc.h"
 #include "../include/tools.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 /*
  * To realize cross-platform programming.
@@ -261,6 +264,88 @@ int flu_var_read(FILE * fp, double * U, const int num)
 }
 
 
+/**
+ * @brief Number of data formatted into the buffer in one pass of function 'flu_var_write()'.
+ */
+#define WRITE_BLOCK 65536
+
+/**
+ * @brief This function writes the data array of fluid variables into the output file with format "%.10g\t".
+ * @details The data array is split into blocks. The threads format disjoint slabs of each block
+ *          into their own segment of the buffer concurrently, then the segments are written in order.
+ *          So the output file is byte-identical to writing the data one by one with fprintf().
+ * @param[in] fp:      The pointer to the output file.
+ * @param[in] U:       The pointer to the data array of fluid variables.
+ * @param[in] num:     The number of the data.
+ * @param[in] n_col:   The number of the data in each row.
+ * @param[in] row_end: The string written at the end of each row.
+ * @return It returns 1 if successfully write the file, while returns 0 if failed.
+ */
+int flu_var_write(FILE * fp, const double * U, const int num, const int n_col, const char * row_end)
+{
+    const int len_end = (int)strlen(row_end);
+    const int len_max = 24 + len_end; // The maximum length of "%.10g\t" is 18.
+    const int n_blk   = num < WRITE_BLOCK ? num : WRITE_BLOCK;
+    int n_thread = 1;
+#ifdef _OPENMP
+    n_thread = omp_get_max_threads();
+#endif
+    char * buf = (char *)malloc((size_t)n_blk * len_max + 1);
+    int * seg = (int *)malloc(2 * n_thread * sizeof(int)); // start and length of segment of each thread
+    if (buf == NULL || seg == NULL)
+	{
+	    free(buf);
+	    free(seg);
+	    fprintf(stderr, "Not enough memory in output data formatting!\n");
+	    return 0;
+	}
+
+    int i0, n, t;
+    for(i0 = 0; i0 < num; i0 += n)
+	{
+	    n = num - i0 < WRITE_BLOCK ? num - i0 : WRITE_BLOCK;
+	    for(t = 0; t < 2*n_thread; t++)
+		seg[t] = 0;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(n_thread) private(t) if(n > 4096)
+#endif
+	    {
+		int nt = 1, i, i_end, len = 0;
+		t = 0;
+#ifdef _OPENMP
+		t  = omp_get_thread_num();
+		nt = omp_get_num_threads();
+#endif
+		i     = (int)((long long)n *  t    / nt);
+		i_end = (int)((long long)n * (t+1) / nt);
+		char * p = buf + (size_t)i * len_max;
+		seg[2*t] = i;
+		for( ; i < i_end; i++)
+		    {
+			len += sprintf(p + len, "%.10g\t", U[i0+i]);
+			if ((i0+i+1) % n_col == 0)
+			    {
+				memcpy(p + len, row_end, len_end);
+				len += len_end;
+			    }
+		    }
+		seg[2*t+1] = len;
+	    }
+	    for(t = 0; t < n_thread; t++)
+		if (seg[2*t+1] && fwrite(buf + (size_t)seg[2*t] * len_max, 1, seg[2*t+1], fp) != (size_t)seg[2*t+1])
+		    {
+			free(buf);
+			free(seg);
+			fprintf(stderr, "Output data writing error!\n");
+			return 0;
+		    }
+	}
+    free(buf);
+    free(seg);
+    return 1;
+}
+
+
 /**
  * @brief Compare function of double for sort function 'qsort()'.
  */
@@ -18,12 +18,12 @@
  * @param[in] argc_least: The least value of the ARGument Counter.
  * @param[in] argc:       ARGument Counter.
  * @param[in] argv:       ARGument Values.
- * @param[in] scheme:     Scheme name.
+ * @param[out] scheme:    Pointer to the scheme name.
  *          - argv[1]: Folder name of test example (input path).
  *          - argv[3]: Order of numerical scheme[_scheme name] (= 1[_Riemann_exact] or 2[_GRP]).
  *          - argv[argc_least+1,argc_least+2,…]: Configuration supplement config[n]=(double)C (= n=C).
  */
-void arg_preprocess(const int argc_least, const int argc, char *argv[], char * scheme)
+void arg_preprocess(const int argc_least, const int argc, char *argv[], char ** scheme)
 {
     int k, j;
     printf("\n");
@@ -59,10 +59,10 @@ void arg_preprocess(const int argc_least, const int argc, char *argv[], char * s
     printf("Order[_Scheme]: \x1b[41;37m%s\x1b[0m\n",argv[3]);
 #endif
     errno = 0;
-    order = strtoul(argv[3], &scheme, 10);
-    if (*scheme == '_')
-	scheme++;
-    else if (*scheme != '\0' || errno == ERANGE)
+    order = strtoul(argv[3], scheme, 10);
+    if (**scheme == '_')
+	(*scheme)++;
+    else if (**scheme != '\0' || errno == ERANGE)
 	{
 	    printf("No order or Wrog scheme!\n");
 	    exit(4);
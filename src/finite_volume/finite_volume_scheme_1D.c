@@ -0,0 +1,998 @@
+/**
+ * @file  finite_volume_scheme_1D.c
+ * @brief This is a Godunov/GRP scheme to solve 1-D Euler equations on Eulerian, Lagrangian or ALE coordinate.
+ * @details The coordinate framework and the order of the scheme are constant arguments of one inline engine,
+ *          so every combination is compiled into its own time loop without run-time branches.
+ *          All working arrays are slices of one buffer in structure-of-arrays layout. The reconstruction,
+ *          flux and update loops run over plain arrays, and only the Riemann/GRP solver is called per face.
+ *          With OpenMP the face and cell loops are shared among threads when there are at least 'config[48]'
+ *          grid cells, the CFL condition and the health monitor are reduced inside them.
+ *          With a fixed time step on Eulerian coordinate, 'config[49]' time steps can be advanced at once
+ *          in cache-sized tiles (temporal blocking).
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <time.h>
+#include <stdbool.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "../include/var_struc.h"
+#include "../include/riemann_solver.h"
+#include "../include/inter_process.h"
+#include "../include/finite_volume.h"
+#include "../include/tools.h"
+
+
+//! Coordinate framework of the 1-D scheme, the values of 'config[8]'.
+enum coord_frame {EUL = 0, LAG = 1, ALE = 2};
+
+#define N_CELL_ARR 5  //!< Number of working arrays on grid cells.
+#define N_FACE_ARR 20 //!< Number of working arrays on grid interfaces.
+
+/**
+ * @brief This function gives the length of the grid cell j.
+ * @param[in] el: Coordinate framework (EUL, LAG or ALE).
+ * @param[in] h:  Length of the initial spatial grids.
+ * @param[in] X:  Coordinate of the grid nodes.
+ * @param[in] H:  Lengths of the grid cells updated incrementally on ALE coordinate.
+ * @param[in] j:  Serial number of the grid cell.
+ * @return    Length of the grid cell j.
+ */
+static inline double h_cell(const int el, const double h, const double * X, const double * H, const int j)
+{
+    if (el == LAG)
+	return X[j+1] - X[j];
+    if (el == ALE)
+	return H[j];
+    return h;
+}
+
+/**
+ * @brief This function computes h/S_max of the waves on both sides of an interface.
+ * @param[in] el:    Coordinate framework (EUL, LAG or ALE).
+ * @param[in] h_L:   Length of the left grid cell.
+ * @param[in] h_R:   Length of the right grid cell.
+ * @param[in] c_L:   Speed of sound on the left side.
+ * @param[in] c_R:   Speed of sound on the right side.
+ * @param[in] U_L:   Velocity on the left side.
+ * @param[in] U_R:   Velocity on the right side.
+ * @return    h/S_max of the interface.
+ */
+static inline double h_S_face(const int el, const double h_L, const double h_R,
+			      const double c_L, const double c_R, const double U_L, const double U_R)
+{
+    if (el == LAG)
+	return fmin(h_L/c_L, h_R/c_R);
+    return fmin(h_L/(fabs(U_L)+fabs(c_L)), h_R/(fabs(U_R)+fabs(c_R)));
+}
+
+/**
+ * @brief This function advances the 1-D Eulerian Godunov/GRP scheme K time steps of fixed length tile by tile (temporal blocking).
+ * @details Every tile of 'config[50]' grid cells is copied into a window together with order*K halo grid cells on both sides,
+ *          and advanced K time steps there while its valid part shrinks by 'order' grid cells on each side per time step.
+ *          The window stays in cache, so the fields are read and written once per K time steps instead of several times
+ *          in every time step. Each grid cell goes through the same floating point operations as in scheme_1D(),
+ *          the results are identical. The tiles are shared among OpenMP threads.
+ * @param[in] order:      Order of the scheme (1: Godunov, 2: GRP).
+ * @param[in] m:          Number of the grids.
+ * @param[in] K:          Number of time steps in this block.
+ * @param[in] k:          Serial number of the first time step in this block.
+ * @param[in] tau:        The length of the time step.
+ * @param[in,out] RHO, U, P, E: Fluid variables of the grid cells at the current plot time step.
+ * @param[in,out] s_rho, s_u, s_p: Slopes of the grid cells.
+ * @param[in] bfv_L0:     Left  boundary condition at the beginning of this block.
+ * @param[in] bfv_R0:     Right boundary condition at the beginning of this block.
+ * @param[out] out:       Buffer of 7*m values for the fields at the end of this block.
+ * @param[out] hv:        Health monitor variables of the K time steps, not yet multiplied by the grid length.
+ * @param[in] par:        Whether the tiles are shared among threads.
+ * @return    miscalculation indicator.
+ *   @retval  0: Successful calculation.
+ *   @retval  1: Calculation error of interfacial fluxes or updates, the run stops after this block.
+ *   @retval -1: Calculation error of left/right states or not enough memory.
+ */
+static int tiled_steps_EUL(const int order, const int m, const int K, const int k, const double tau,
+			   double * RHO, double * U, double * P, double * E, double * s_rho, double * s_u, double * s_p,
+			   const struct b_f_var bfv_L0, const struct b_f_var bfv_R0, double * out, struct health_var hv[], const _Bool par)
+{
+    double const eps   = config[4];       // the largest value could be seen as zero
+    double const gamma = config[6];       // the constant of the perfect gas
+    double const h     = config[10];      // the length of the initial spatial grids
+    int    const bound = (int)config[17]; // the boundary condition in x-direction
+    double const alpha = config[41];      // the paramater in slope limiters
+    int    const T     = (int)config[50]; // the number of grid cells owned by a tile
+    int    const halo  = order*K;
+    int    const N_tile = (m + T - 1) / T;
+    int    const W_max  = T + 2*halo;
+    double const nu = tau / h;
+    _Bool stop_b = false, err_b = false;
+    int j, s;
+
+    for(s = 0; s < K; ++s)
+	hv[s] = (struct health_var){0.0, 0.0, 0.0, 0.0, INFINITY, INFINITY, 0.0, 0};
+
+#ifdef _OPENMP
+#pragma omp parallel private(j, s) if(par)
+#endif
+    {
+	// the window of a tile: variables and slopes of grid cells, the values at t_{n+1} and fluxes on grid interfaces
+	double * win = (double *)malloc((7*W_max + 6*(W_max+1)) * sizeof(double));
+	struct health_var * hv_t = (struct health_var *)malloc(K * sizeof(struct health_var));
+	double * rho = win, * u = rho + W_max, * p = u + W_max, * e = p + W_max;
+	double * sr  = e + W_max, * su = sr + W_max, * sp = su + W_max;
+	double * RN  = sp + W_max, * UN = RN + (W_max+1), * PN = UN + (W_max+1);
+	double * FR  = PN + (W_max+1), * FU = FR + (W_max+1), * FE = FU + (W_max+1);
+	struct i_f_var ifv_L = {.gamma = gamma}, ifv_R = ifv_L;
+	struct b_f_var bfv_L, bfv_R;
+	double dire[6], mid[6];
+	double Mom, Ene, s_L, s_R, RHO_t, U_t, P_t;
+	int t, l, a, b, wa, wb, W, c0, c1, L0, L1, F0, F1;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic) reduction(||:stop_b, err_b)
+#endif
+	for(t = 0; t < N_tile; ++t)
+	    {
+		if(win == NULL || hv_t == NULL)
+		    {
+			printf("NOT enough memory! Window of temporal blocking\n");
+			err_b = true;
+			continue;
+		    }
+		a  = t*T;
+		b  = a+T < m ? a+T : m;
+		wa = a-halo > 0 ? a-halo : 0;
+		wb = b+halo < m ? b+halo : m;
+		W  = wb - wa;
+		for(l = 0; l < W; ++l)
+		    {
+			rho[l] = RHO[wa+l]; u[l] = U[wa+l]; p[l] = P[wa+l]; e[l] = E[wa+l];
+			sr[l] = s_rho[wa+l]; su[l] = s_u[wa+l]; sp[l] = s_p[wa+l];
+		    }
+		bfv_L = bfv_L0;
+		bfv_R = bfv_R0;
+		// [c0, c1) is the valid part of the window, it is the whole window at the beginning.
+		c0 = 0;
+		c1 = W;
+		for(s = 0; s < K; ++s)
+		    {
+			hv_t[s] = (struct health_var){0.0, 0.0, 0.0, 0.0, INFINITY, INFINITY, 0.0, 0};
+			if(wa == 0)
+			    switch(bound)
+				{
+				case -2: case -24:
+				    bfv_L.U = -u[0]; bfv_L.P = p[0]; bfv_L.RHO = rho[0];
+				    break;
+				case -4:
+				    bfv_L.U =  u[0]; bfv_L.P = p[0]; bfv_L.RHO = rho[0];
+				    break;
+				}
+			if(wb == m)
+			    switch(bound)
+				{
+				case -2:
+				    bfv_R.U = -u[W-1]; bfv_R.P = p[W-1]; bfv_R.RHO = rho[W-1];
+				    break;
+				case -4: case -24:
+				    bfv_R.U =  u[W-1]; bfv_R.P = p[W-1]; bfv_R.RHO = rho[W-1];
+				    break;
+				}
+			// slopes limited on [L0, L1)
+			L0 = wa == 0 ? 0 : c0 + (order > 1);
+			L1 = wb == m ? W : c1 - (order > 1);
+			if (order > 1)
+			    {
+				for(l = L0; l < L1; ++l)
+				    {
+					s_L = (u[l] - (l     ? u[l-1] : bfv_L.U)) / h;
+					s_R = ((l < W-1 ? u[l+1] : bfv_R.U) - u[l]) / h;
+					su[l] = minmod3(alpha*s_L, alpha*s_R, su[l]);
+					s_L = (p[l] - (l     ? p[l-1] : bfv_L.P)) / h;
+					s_R = ((l < W-1 ? p[l+1] : bfv_R.P) - p[l]) / h;
+					sp[l] = minmod3(alpha*s_L, alpha*s_R, sp[l]);
+					s_L = (rho[l] - (l     ? rho[l-1] : bfv_L.RHO)) / h;
+					s_R = ((l < W-1 ? rho[l+1] : bfv_R.RHO) - rho[l]) / h;
+					sr[l] = minmod3(alpha*s_L, alpha*s_R, sr[l]);
+				    }
+				if(wa == 0 && (bound == -2 || bound == -24))
+				    bfv_L.SU = su[0];
+				if(wb == m && bound == -2)
+				    bfv_R.SU = su[W-1];
+			    }
+			// interfaces [F0, F1] between the grid cells with limited slopes
+			F0 = wa == 0 ? 0 : L0 + 1;
+			F1 = wb == m ? W : L1 - 1;
+			for(l = F0; l <= F1; ++l)
+			    {
+				if(l + wa == 0)
+				    {
+					ifv_L.RHO = bfv_L.RHO; ifv_L.U = bfv_L.U; ifv_L.P = bfv_L.P;
+					ifv_L.d_rho = bfv_L.SRHO; ifv_L.d_u = bfv_L.SU; ifv_L.d_p = bfv_L.SP;
+				    }
+				else
+				    {
+					ifv_L.RHO = rho[l-1]; ifv_L.U = u[l-1]; ifv_L.P = p[l-1];
+					ifv_L.d_rho = sr[l-1]; ifv_L.d_u = su[l-1]; ifv_L.d_p = sp[l-1];
+				    }
+				if(l + wa == m)
+				    {
+					ifv_R.RHO = bfv_R.RHO; ifv_R.U = bfv_R.U; ifv_R.P = bfv_R.P;
+					ifv_R.d_rho = bfv_R.SRHO; ifv_R.d_u = bfv_R.SU; ifv_R.d_p = bfv_R.SP;
+				    }
+				else
+				    {
+					ifv_R.RHO = rho[l]; ifv_R.U = u[l]; ifv_R.P = p[l];
+					ifv_R.d_rho = sr[l]; ifv_R.d_u = su[l]; ifv_R.d_p = sp[l];
+				    }
+				if (order > 1)
+				    {
+					ifv_L.RHO += 0.5*h*ifv_L.d_rho;
+					ifv_L.U   += 0.5*h*ifv_L.d_u;
+					ifv_L.P   += 0.5*h*ifv_L.d_p;
+					ifv_R.RHO -= 0.5*h*ifv_R.d_rho;
+					ifv_R.U   -= 0.5*h*ifv_R.d_u;
+					ifv_R.P   -= 0.5*h*ifv_R.d_p;
+					if(ifvar_check(&ifv_L, &ifv_R, 1))
+					    {
+						printf(" on [%d, %d] (t_n, x).\n", k+s, wa+l);
+						err_b = true;
+						continue;
+					    }
+				    }
+				else
+				    ifv_L.d_rho = ifv_L.d_u = ifv_L.d_p = ifv_R.d_rho = ifv_R.d_u = ifv_R.d_p = 0.0;
+				linear_GRP_solver_Edir(dire, mid, &ifv_L, &ifv_R, eps, order > 1 ? eps : INFINITY);
+				if(star_dire_check(mid, dire, 1))
+				    {
+					printf(" on [%d, %d] (t_n, x).\n", k+s, wa+l);
+					stop_b = true;
+				    }
+				RHO_t = dire[0]; U_t = dire[1]; P_t = dire[2];
+				RN[l] = mid[0];  UN[l] = mid[1]; PN[l] = mid[2];
+				if (order > 1)
+				    {
+					RN[l] += 0.5 * tau * RHO_t;
+					UN[l] += 0.5 * tau * U_t;
+					PN[l] += 0.5 * tau * P_t;
+				    }
+				FR[l] = RN[l]*UN[l];
+				FU[l] = FR[l]*UN[l] + PN[l];
+				FE[l] = (gamma/(gamma-1.0))*PN[l] + 0.5*FR[l]*UN[l];
+				FE[l] = FE[l]*UN[l];
+				if (order > 1)
+				    {
+					RN[l] += 0.5 * tau * RHO_t;
+					UN[l] += 0.5 * tau * U_t;
+					PN[l] += 0.5 * tau * P_t;
+				    }
+			    }
+			// grid cells [F0, F1) between two new fluxes
+			for(l = F0; l < F1; ++l)
+			    {
+				Mom = rho[l]*u[l] - nu*(FU[l+1]-FU[l]);
+				Ene = rho[l]*e[l] - nu*(FE[l+1]-FE[l]);
+				rho[l] = rho[l] - nu*(FR[l+1]-FR[l]);
+				u[l] = Mom / rho[l];
+				e[l] = Ene / rho[l];
+				p[l] = (Ene - 0.5*Mom*u[l])*(gamma-1.0);
+				if (order > 1)
+				    {
+					su[l] = (UN[l+1] - UN[l])/h;
+					sp[l] = (PN[l+1] - PN[l])/h;
+					sr[l] = (RN[l+1] - RN[l])/h;
+				    }
+				if(wa+l < a || wa+l >= b) // halo
+				    continue;
+				if(p[l] < eps || rho[l] < eps)
+				    {
+					printf("<0.0 error on [%d, %d] (t_n, x) - Update\n", k+s, wa+l);
+					stop_b = true;
+				    }
+				hv_t[s].mass   += rho[l];
+				hv_t[s].mom_x  += Mom;
+				hv_t[s].ene    += Ene;
+				hv_t[s].rho_min = fmin(hv_t[s].rho_min, rho[l]);
+				hv_t[s].p_min   = fmin(hv_t[s].p_min, p[l]);
+				hv_t[s].Ma_max  = fmax(hv_t[s].Ma_max, fabs(u[l])/sqrt(gamma*p[l]/rho[l]));
+				hv_t[s].n_nan  += !isfinite(rho[l]) || !isfinite(p[l]) || !isfinite(Mom);
+			    }
+			c0 = F0;
+			c1 = F1;
+		    }
+		for(j = a; j < b; ++j)
+		    {
+			l = j - wa;
+			out[j]     = rho[l]; out[m+j]   = u[l];  out[2*m+j] = p[l];  out[3*m+j] = e[l];
+			out[4*m+j] = sr[l];  out[5*m+j] = su[l]; out[6*m+j] = sp[l];
+		    }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+		for(s = 0; s < K; ++s)
+		    {
+			hv[s].mass   += hv_t[s].mass;
+			hv[s].mom_x  += hv_t[s].mom_x;
+			hv[s].ene    += hv_t[s].ene;
+			hv[s].rho_min = fmin(hv[s].rho_min, hv_t[s].rho_min);
+			hv[s].p_min   = fmin(hv[s].p_min, hv_t[s].p_min);
+			hv[s].Ma_max  = fmax(hv[s].Ma_max, hv_t[s].Ma_max);
+			hv[s].n_nan  += hv_t[s].n_nan;
+		    }
+	    }
+	free(win);
+	free(hv_t);
+    }
+    if(err_b)
+	return -1;
+
+#ifdef _OPENMP
+#pragma omp parallel for if(par)
+#endif
+    for(j = 0; j < m; ++j)
+	{
+	    RHO[j]   = out[j];     U[j]   = out[m+j];   P[j]   = out[2*m+j]; E[j] = out[3*m+j];
+	    s_rho[j] = out[4*m+j]; s_u[j] = out[5*m+j]; s_p[j] = out[6*m+j];
+	}
+    return stop_b;
+}
+
+/**
+ * @brief This function is the engine of the 1-D Godunov/GRP scheme.
+ * @param[in] el:         Coordinate framework (EUL, LAG or ALE), constant at every call site.
+ * @param[in] order:      Order of the scheme (1: Godunov, 2: GRP), constant at every call site.
+ * @param[in] m:          Number of the grids.
+ * @param[in,out] CV:     Structure of cell variable data.
+ * @param[in,out] X[]:    Array of the coordinate data.
+ * @param[out] cpu_time:  Array of the CPU time recording.
+ * @param[in,out] N_plot: Pointer to the number of time steps for plotting.
+ * @param[in,out] time_plot: Array of the plotting time recording.
+ */
+static inline void scheme_1D(const int el, const int order, const int m, struct cell_var_stru CV, double * X[],
+			     double * cpu_time, int * N_plot, double time_plot[])
+{
+    /*
+     * j is a frequently used index for spatial variables.
+     * k is a frequently used index for the time step.
+     */
+  int j, k = 0;
+
+  double tic, toc;
+  double cpu_time_sum = 0.0;
+
+  double const t_all = config[1];       // the total time
+  double const eps   = config[4];       // the largest value could be seen as zero
+  int    const N     = (int)config[5];  // the maximum number of time steps
+  double const gamma = config[6];       // the constant of the perfect gas
+  double const CFL   = config[7];       // the CFL number
+  double const h     = config[10];      // the length of the initial spatial grids
+  double       tau   = config[16];      // the length of the time step
+  int    const bound = (int)config[17]; // the boundary condition in x-direction
+  _Bool  const par   = m >= (int)config[48]; // whether the loops are shared among threads
+#ifdef _OPENMP
+  if (par)
+      printf("@@ Number of threads for OpenMP: %d\n", omp_get_max_threads());
+#endif
+  // temporal blocking of time steps with fixed length on Eulerian coordinate
+  int    const K_tile = (int)config[49];
+  _Bool  const tiled  = el == EUL && K_tile > 1 && (int)config[50] >= 1 && bound != -7 && !isfinite(t_all) && isfinite(tau) && tau > 0.0;
+  int K_b, kb; // the number of time steps in a block and its index
+  double t_b;
+  double * out = NULL;
+  struct health_var * hv_b = NULL;
+
+  _Bool find_bound = false;
+
+  double Mom, Ene;
+  // health monitor variables reduced in the update loop
+  const _Bool health = (_Bool)config[38];
+  struct health_var hv;
+  double h_mass, h_mom, h_ene, h_rho_min, h_p_min, h_Ma_max;
+  int h_nan, n_bad; // number of cells with NAN/INFinite, negative density or pressure
+  double c_L, c_R; // the speeds of sound
+  double h_L, h_R; // length of spatial grids
+  _Bool CRW[2]; // Centred Rarefaction Wave (CRW) Indicator
+  double u_star, p_star; // the Riemann solutions
+  /*
+   * dire: the temporal derivative of fluid variables.
+   *       \frac{\partial [rho_L, u, p, rho_R]}{\partial t}
+   * mid:  the Riemann solutions.
+   *       [rho_star_L, u_star, p_star, rho_star_R]
+   * On ALE coordinate they are sampled along the grid node trajectory, with the layout
+   * [rho, u, v, p, phi, z_a] of the moving GRP solver.
+   */
+  double dire[6], mid[6];
+  double wave_speed[2], star[6]; // unused outputs of the moving GRP solver
+  Mesh_Velocity_1D mesh_velocity = mesh_velocity_EUL;
+
+  double nu;  // nu = tau/h
+  double h_S_max; // h/S_max, S_max is the maximum wave speed
+  double tau_c; // the length of the time step for the grid cells shrinking by half on ALE coordinate
+  _Bool ifv_err; // miscalculation indicator of the interfacial variables
+  double time_c = 0.0; // the current time
+  double C_m = 1.01; // a multiplicative coefficient allows the time step to increase.
+  _Bool stop_t = false;
+  int nt = 0; // the number of times storing plotting data
+
+  struct b_f_var bfv_L = {.H = h, .SRHO = 0.0, .SP = 0.0, .SU = 0.0}, bfv_R = bfv_L; // Left/Right boundary condition
+  struct i_f_var ifv_L = {.gamma = gamma}, ifv_R = ifv_L;
+
+  double ** RHO  = CV.RHO;
+  double ** U    = CV.U;
+  double ** P    = CV.P;
+  double ** E    = CV.E;
+
+  double * buffer = (double*)calloc(N_CELL_ARR*m + N_FACE_ARR*(m+1), sizeof(double));
+  if(buffer == NULL)
+      {
+	  printf("NOT enough memory! Buffer of 1-D scheme\n");
+	  goto return_NULL;
+      }
+  // the slopes of variable values and the mass in computational cells.
+  double * s_rho = buffer;
+  double * s_u   = s_rho + m;
+  double * s_p   = s_u   + m;
+  double * MASS  = s_p   + m;
+  // the lengths of computational cells on ALE coordinate.
+  double * H     = MASS  + m;
+  CV.d_rho = s_rho;
+  CV.d_u   = s_u;
+  CV.d_p   = s_p;
+  // the reconstructed left/right states at (x_{j-1/2}, t_{n}).
+  double * RHO_L = H     + m;
+  double * U_L   = RHO_L + (m+1);
+  double * P_L   = U_L   + (m+1);
+  double * RHO_R = P_L   + (m+1);
+  double * U_R   = RHO_R + (m+1);
+  double * P_R   = U_R   + (m+1);
+  // the variable values at (x_{j-1/2}, t_{n+1}).
+  double * RHO_next_L = P_R        + (m+1);
+  double * RHO_next_R = RHO_next_L + (m+1);
+  double * U_next     = RHO_next_R + (m+1);
+  double * P_next     = U_next     + (m+1);
+  // the temporal derivatives at (x_{j-1/2}, t_{n}).
+  double * RHO_t_L = P_next  + (m+1);
+  double * RHO_t_R = RHO_t_L + (m+1);
+  double * U_t     = RHO_t_R + (m+1);
+  double * P_t     = U_t     + (m+1);
+  // the numerical flux at (x_{j-1/2}, t_{n+1/2}).
+  double * F_rho = P_t   + (m+1);
+  double * F_u   = F_rho + (m+1);
+  double * F_e   = F_u   + (m+1);
+  double * U_F   = F_e   + (m+1);
+  double * P_F   = U_F   + (m+1);
+  // the velocity of grid nodes x_{j-1/2} on ALE coordinate.
+  double * W     = P_F   + (m+1);
+
+  if (tiled)
+      {
+	  out  = (double*)malloc(7*m * sizeof(double));
+	  hv_b = (struct health_var*)malloc(K_tile * sizeof(struct health_var));
+	  if(out == NULL || hv_b == NULL)
+	      {
+		  printf("NOT enough memory! Buffer of temporal blocking\n");
+		  goto return_NULL;
+	      }
+	  printf("Temporal blocking of %d time steps in tiles of %d grid cells.\n", K_tile, (int)config[50]);
+      }
+  if (el == LAG)
+      for(j = 0; j < m; ++j) // Initialize the values of mass in computational cells
+	  MASS[j] = h * RHO[0][j];
+  if (el == ALE)
+      {
+	  for(j = 0; j < m; ++j) // Initialize the lengths of computational cells
+	      H[j] = X[0][j+1] - X[0][j];
+	  switch((int)config[45])
+	      {
+	      case 0:
+		  mesh_velocity = mesh_velocity_EUL; break;
+	      case 1:
+		  mesh_velocity = mesh_velocity_LAG; break;
+	      case 2:
+		  mesh_velocity = mesh_velocity_adaptive; break;
+	      default:
+		  printf("No suitable mesh motion strategy of the ALE scheme!\n");
+		  goto return_NULL;
+	      }
+      }
+
+//-----------------------THE MAIN LOOP--------------------------------
+  for(k = 1; k <= N; ++k)
+  {
+#ifdef _OPENMP
+      tic = omp_get_wtime();
+#else
+      tic = (double)clock() / (double)CLOCKS_PER_SEC;
+#endif
+      if (time_c >= time_plot[nt] && nt < (*N_plot-1))
+	  {
+	      for(j = 0; j < m; ++j)
+		  {
+		      RHO[nt+1][j] = RHO[nt][j];
+		      U[nt+1][j]   =   U[nt][j];
+		      E[nt+1][j]   =   E[nt][j];
+		      P[nt+1][j]   =   P[nt][j];
+		  }
+	      if (el != EUL)
+		  for(j = 0; j <= m; ++j)
+		      X[nt+1][j] = X[nt][j];
+	      nt++;
+	  }
+
+      if (tiled && find_bound)
+	  {
+	      // The block of time steps ends before the next plotting time.
+	      K_b = 1;
+	      for(t_b = time_c + tau; K_b < K_tile && k + K_b <= N && !(t_b >= time_plot[nt] && nt < (*N_plot-1)); t_b += tau)
+		  K_b++;
+	      if (K_b > 1)
+		  {
+		      switch (tiled_steps_EUL(order, m, K_b, k, tau, RHO[nt], U[nt], P[nt], E[nt], s_rho, s_u, s_p, bfv_L, bfv_R, out, hv_b, par))
+			  {
+			  case -1:
+			      goto return_NULL;
+			  case 1:
+			      stop_t = true;
+			  }
+		      for(kb = 0; kb < K_b; ++kb)
+			  {
+			      time_c += tau;
+			      hv = hv_b[kb];
+			      hv.mass  *= h;
+			      hv.mom_x *= h;
+			      hv.ene   *= h;
+			      if (health && health_check(&hv, k+kb, time_c))
+				  stop_t = true;
+			  }
+		      k += K_b-1;
+		      DispPro(k*100.0/N, k);
+		      if(stop_t || !isfinite(time_c))
+			  break;
+#ifdef _OPENMP
+		      toc = omp_get_wtime();
+#else
+		      toc = (double)clock() / (double)CLOCKS_PER_SEC;
+#endif
+		      cpu_time_sum += toc - tic;
+		      cpu_time[nt]  = cpu_time_sum;
+		      continue;
+		  }
+	  }
+
+      h_S_max = INFINITY; // h/S_max = INFINITY
+
+      if (el != EUL)
+	  find_bound = bound_cond_slope_limiter(true, m, nt, &CV, &bfv_L, &bfv_R, find_bound, order > 1, time_c, X[nt]);
+      else
+	  find_bound = bound_cond_slope_limiter(false, m, nt, &CV, &bfv_L, &bfv_R, find_bound, order > 1, time_c);
+      if(!find_bound)
+	  goto return_NULL;
+
+//========================Reconstruction========================
+#ifdef _OPENMP
+#pragma omp parallel for private(h_L, h_R, c_L, c_R) reduction(min:h_S_max) if(par)
+#endif
+      for(j = 1; j < m; ++j)
+	  { /*
+	     *  j-1          j          j+1
+	     * j-1/2  j-1  j+1/2   j   j+3/2  j+1
+	     *   o-----X-----o-----X-----o-----X--...
+	     */
+	      h_L = h_cell(el, h, X[nt], H, j-1);
+	      h_R = h_cell(el, h, X[nt], H, j);
+	      RHO_L[j] = RHO[nt][j-1];
+	      U_L[j]   =   U[nt][j-1];
+	      P_L[j]   =   P[nt][j-1];
+	      RHO_R[j] = RHO[nt][j];
+	      U_R[j]   =   U[nt][j];
+	      P_R[j]   =   P[nt][j];
+	      if (order > 1)
+		  {
+		      RHO_L[j] += 0.5*h_L*s_rho[j-1];
+		      U_L[j]   += 0.5*h_L*  s_u[j-1];
+		      P_L[j]   += 0.5*h_L*  s_p[j-1];
+		      RHO_R[j] -= 0.5*h_R*s_rho[j];
+		      U_R[j]   -= 0.5*h_R*  s_u[j];
+		      P_R[j]   -= 0.5*h_R*  s_p[j];
+		  }
+	      c_L = sqrt(gamma * P_L[j] / RHO_L[j]);
+	      c_R = sqrt(gamma * P_R[j] / RHO_R[j]);
+	      h_S_max = fmin(h_S_max, h_S_face(el, h_L, h_R, c_L, c_R, U_L[j], U_R[j]));
+	  }
+      // left boundary
+      h_L = el != EUL ? bfv_L.H : h;
+      h_R = h_cell(el, h, X[nt], H, 0);
+      RHO_L[0] = bfv_L.RHO;
+      U_L[0]   = bfv_L.U;
+      P_L[0]   = bfv_L.P;
+      RHO_R[0] = RHO[nt][0];
+      U_R[0]   =   U[nt][0];
+      P_R[0]   =   P[nt][0];
+      if (order > 1)
+	  {
+	      RHO_L[0] += 0.5*h_L*bfv_L.SRHO;
+	      U_L[0]   += 0.5*h_L*bfv_L.SU;
+	      P_L[0]   += 0.5*h_L*bfv_L.SP;
+	      RHO_R[0] -= 0.5*h_R*s_rho[0];
+	      U_R[0]   -= 0.5*h_R*  s_u[0];
+	      P_R[0]   -= 0.5*h_R*  s_p[0];
+	  }
+      c_L = sqrt(gamma * P_L[0] / RHO_L[0]);
+      c_R = sqrt(gamma * P_R[0] / RHO_R[0]);
+      h_S_max = fmin(h_S_max, h_S_face(el, h_L, h_R, c_L, c_R, U_L[0], U_R[0]));
+      if (el == LAG && (bound == -2 || bound == -24)) // reflective boundary conditions
+	  h_S_max = fmin(h_S_max, h_L/(fabs(U_L[0])+c_L));
+      // right boundary
+      h_L = h_cell(el, h, X[nt], H, m-1);
+      h_R = el != EUL ? bfv_R.H : h;
+      RHO_L[m] = RHO[nt][m-1];
+      U_L[m]   =   U[nt][m-1];
+      P_L[m]   =   P[nt][m-1];
+      RHO_R[m] = bfv_R.RHO;
+      U_R[m]   = bfv_R.U;
+      P_R[m]   = bfv_R.P;
+      if (order > 1)
+	  {
+	      RHO_L[m] += 0.5*h_L*s_rho[m-1];
+	      U_L[m]   += 0.5*h_L*  s_u[m-1];
+	      P_L[m]   += 0.5*h_L*  s_p[m-1];
+	      RHO_R[m] -= 0.5*h_R*bfv_R.SRHO;
+	      U_R[m]   -= 0.5*h_R*bfv_R.SU;
+	      P_R[m]   -= 0.5*h_R*bfv_R.SP;
+	  }
+      c_L = sqrt(gamma * P_L[m] / RHO_L[m]);
+      c_R = sqrt(gamma * P_R[m] / RHO_R[m]);
+      h_S_max = fmin(h_S_max, h_S_face(el, h_L, h_R, c_L, c_R, U_L[m], U_R[m]));
+      if (el == LAG && bound == -2)
+	  h_S_max = fmin(h_S_max, h_R/(fabs(U_R[m])+c_R));
+
+//====================Time step======================
+    // If no total time, use fixed tau and time step N.
+    if(isfinite(t_all) || !isfinite(config[16]) || config[16] <= 0.0)
+	{
+	    tau = el == LAG ? fmin(CFL * h_S_max, C_m * tau) : CFL * h_S_max;
+	    if(tau < eps)
+		{
+		    printf("\nThe length of the time step is so small on [%d, %g, %g] (t_n, time_c, tau)\n", k, time_c, tau);
+		    stop_t = true;
+		}
+	    else if((time_c + tau) > (t_all - eps))
+		tau = t_all - time_c;
+	    else if(!isfinite(tau))
+		{
+		    printf("NAN or INFinite error on [%d, %g, %g] (t_n, time_c, tau) - CFL\n", k, time_c, tau);
+		    goto return_NULL;
+		}
+	}
+    if (el == ALE) // velocity of the grid nodes
+	{
+	    mesh_velocity(W, m, tau, X[nt], RHO[nt], RHO_L, U_L, P_L, RHO_R, U_R, P_R);
+	    tau_c = INFINITY;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(min:tau_c) if(par)
+#endif
+	    for(j = 0; j < m; ++j) // a grid cell shrinks at most by half in one time step
+		if (W[j] > W[j+1])
+		    tau_c = fmin(tau_c, 0.5*H[j] / (W[j] - W[j+1]));
+	    tau = fmin(tau, tau_c);
+	    if(tau < eps)
+		{
+		    printf("\nThe grid cells collapse on [%d, %g, %g] (t_n, time_c, tau) - ALE\n", k, time_c, tau);
+		    stop_t = true;
+		}
+	}
+    nu = tau / h;
+
+//========================Solve Riemann Problem/GRP========================
+      /* The solvers stay scalar per face: the Newton iteration of the exact Riemann solver runs a data-dependent
+       * number of steps and the wave configurations branch, so the faces are spread over threads instead of SIMD lanes,
+       * while the reconstruction, flux and update loops around it are vectorized.
+       */
+      ifv_err = false;
+#ifdef _OPENMP
+#pragma omp parallel for firstprivate(ifv_L, ifv_R) private(c_L, c_R, CRW, u_star, p_star, dire, mid, wave_speed, star) \
+reduction(||:stop_t, ifv_err) if(par) schedule(dynamic, 64)
+#endif
+      for(j = 0; j <= m; ++j)
+	  {
+	      ifv_L.RHO = RHO_L[j];
+	      ifv_L.U   =   U_L[j];
+	      ifv_L.P   =   P_L[j];
+	      ifv_R.RHO = RHO_R[j];
+	      ifv_R.U   =   U_R[j];
+	      ifv_R.P   =   P_R[j];
+	      if (order > 1) //calculate the material derivatives
+		  {
+		      ifv_L.d_rho = j     ? s_rho[j-1] : bfv_L.SRHO;
+		      ifv_L.d_u   = j     ?   s_u[j-1] : bfv_L.SU;
+		      ifv_L.d_p   = j     ?   s_p[j-1] : bfv_L.SP;
+		      ifv_R.d_rho = j < m ? s_rho[j]   : bfv_R.SRHO;
+		      ifv_R.d_u   = j < m ?   s_u[j]   : bfv_R.SU;
+		      ifv_R.d_p   = j < m ?   s_p[j]   : bfv_R.SP;
+		      if (el == LAG)
+			  {
+			      ifv_L.t_u   =   ifv_L.d_u/ifv_L.RHO;
+			      ifv_L.t_p   =   ifv_L.d_p/ifv_L.RHO;
+			      ifv_L.t_rho = ifv_L.d_rho/ifv_L.RHO;
+			      ifv_R.t_u   =   ifv_R.d_u/ifv_R.RHO;
+			      ifv_R.t_p   =   ifv_R.d_p/ifv_R.RHO;
+			      ifv_R.t_rho = ifv_R.d_rho/ifv_R.RHO;
+			  }
+		      if(ifvar_check(&ifv_L, &ifv_R, 1))
+			  {
+			      printf(" on [%d, %d] (t_n, x).\n", k, j);
+			      ifv_err = true;
+			      continue;
+			  }
+		  }
+
+	      if (el == LAG && order == 1)
+		  {
+		      c_L = sqrt(gamma * ifv_L.P / ifv_L.RHO);
+		      c_R = sqrt(gamma * ifv_R.P / ifv_R.RHO);
+		      Riemann_solver_exact_single(&u_star, &p_star, gamma, ifv_L.U, ifv_R.U, ifv_L.P, ifv_R.P, c_L, c_R, CRW, eps, eps, 500);
+		      if(p_star < eps)
+			  {
+			      printf("<0.0 error on [%d, %d] (t_n, x) - STAR\n", k, j);
+			      stop_t = true;
+			  }
+		      if(!isfinite(p_star)|| !isfinite(u_star))
+			  {
+			      printf("NAN or INFinite error on [%d, %d] (t_n, x) - STAR\n", k, j);
+			      stop_t = true;
+			  }
+		      U_next[j] = u_star;
+		      P_next[j] = p_star;
+		      continue;
+		  }
+
+	      if (el == LAG)
+		  linear_GRP_solver_LAG(dire, mid, &ifv_L, &ifv_R, eps, eps);
+	      else if (el == ALE)
+		  {
+		      ifv_L.lambda_u = W[j];
+		      linear_GRP_solver_Edir_G2D(wave_speed, dire, mid, star, &ifv_L, &ifv_R, eps, order > 1 ? eps : INFINITY);
+		      mid[2]  = mid[3];
+		      dire[2] = dire[3];
+		  }
+	      else
+		  linear_GRP_solver_Edir(dire, mid, &ifv_L, &ifv_R, eps, order > 1 ? eps : INFINITY);
+	      if(star_dire_check(mid, dire, 1))
+		  {
+		      printf(" on [%d, %d] (t_n, x).\n", k, j);
+		      stop_t = true;
+		  }
+	      RHO_next_L[j] = mid[0];
+	      U_next[j]     = mid[1];
+	      P_next[j]     = mid[2];
+	      RHO_t_L[j] = dire[0];
+	      U_t[j]     = dire[1];
+	      P_t[j]     = dire[2];
+	      if (el == LAG)
+		  {
+		      RHO_next_R[j] = mid[3];
+		      RHO_t_R[j]    = dire[3];
+		  }
+	  }
+      if(ifv_err)
+	  goto return_NULL;
+
+//====================Fluxes and grid movement======================
+    if (el == LAG)
+#ifdef _OPENMP
+#pragma omp parallel for if(par)
+#endif
+	for(j = 0; j <= m; ++j)
+	    {
+		U_F[j] = U_next[j];
+		P_F[j] = P_next[j];
+		if (order > 1)
+		    {
+			U_F[j] += 0.5 * tau * U_t[j];
+			P_F[j] += 0.5 * tau * P_t[j];
+
+			RHO_next_L[j] += tau * RHO_t_L[j];
+			RHO_next_R[j] += tau * RHO_t_R[j];
+			U_next[j]     += tau * U_t[j];
+			P_next[j]     += tau * P_t[j];
+		    }
+		X[nt][j] += tau * U_F[j]; // motion along the contact discontinuity
+	    }
+    else
+#ifdef _OPENMP
+#pragma omp parallel for if(par)
+#endif
+	for(j = 0; j <= m; ++j)
+	    {
+		if (order > 1)
+		    {
+			RHO_next_L[j] += 0.5 * tau * RHO_t_L[j];
+			U_next[j]     += 0.5 * tau * U_t[j];
+			P_next[j]     += 0.5 * tau * P_t[j];
+		    }
+		if (el == ALE) // flux relative to the moving grid node
+		    {
+			F_rho[j] = RHO_next_L[j]*(U_next[j] - W[j]);
+			F_u[j] = F_rho[j]*U_next[j] + P_next[j];
+			F_e[j] = (U_next[j] - W[j])*(P_next[j]/(gamma-1.0) + 0.5*RHO_next_L[j]*U_next[j]*U_next[j]);
+			F_e[j] = F_e[j] + P_next[j]*U_next[j];
+			X[nt][j] += tau * W[j];
+		    }
+		else
+		    {
+			F_rho[j] = RHO_next_L[j]*U_next[j];
+			F_u[j] = F_rho[j]*U_next[j] + P_next[j];
+			F_e[j] = (gamma/(gamma-1.0))*P_next[j] + 0.5*F_rho[j]*U_next[j];
+			F_e[j] = F_e[j]*U_next[j];
+		    }
+		if (order > 1)
+		    {
+			RHO_next_L[j] += 0.5 * tau * RHO_t_L[j];
+			U_next[j]     += 0.5 * tau * U_t[j];
+			P_next[j]     += 0.5 * tau * P_t[j];
+		    }
+	    }
+
+//======================THE CORE ITERATION=========================
+    h_mass = h_mom = h_ene = h_Ma_max = 0.0;
+    h_rho_min = h_p_min = INFINITY;
+    h_nan = n_bad = 0;
+#ifdef _OPENMP
+#pragma omp parallel for private(Mom, Ene, h_L) \
+reduction(+:h_mass, h_mom, h_ene, h_nan, n_bad) reduction(min:h_rho_min, h_p_min) reduction(max:h_Ma_max) if(par)
+#endif
+    for(j = 0; j < m; ++j) // forward Euler
+	{ /*
+	   *  j-1          j          j+1
+	   * j-1/2  j-1  j+1/2   j   j+3/2  j+1
+	   *   o-----X-----o-----X-----o-----X--...
+	   */
+	    if (el == LAG) // On Lagrangian Coordinate
+		{
+		    RHO[nt][j] = 1.0 / (1.0/RHO[nt][j] + tau/MASS[j]*(U_F[j+1] - U_F[j]));
+		    U[nt][j]   = U[nt][j] - tau/MASS[j]*(P_F[j+1] - P_F[j]);
+		    E[nt][j]   = E[nt][j] - tau/MASS[j]*(P_F[j+1]*U_F[j+1] - P_F[j]*U_F[j]);
+		    P[nt][j]   = (E[nt][j] - 0.5 * U[nt][j]*U[nt][j]) * (gamma - 1.0) * RHO[nt][j];
+		    Mom = MASS[j]*U[nt][j];
+		    Ene = MASS[j]*E[nt][j];
+		    h_mass += MASS[j];
+		}
+	    else if (el == ALE) // On ALE Coordinate, the lengths of cells satisfy the geometric conservation law
+		{
+		    MASS[j] = H[j]*RHO[nt][j]           - tau*(F_rho[j+1]-F_rho[j]);
+		    Mom     = H[j]*RHO[nt][j]*U[nt][j] - tau*(F_u[j+1]  -F_u[j]);
+		    Ene     = H[j]*RHO[nt][j]*E[nt][j] - tau*(F_e[j+1]  -F_e[j]);
+		    H[j]   += tau*(W[j+1] - W[j]);
+
+		    RHO[nt][j] = MASS[j] / H[j];
+		    U[nt][j]   = Mom / MASS[j];
+		    E[nt][j]   = Ene / MASS[j];
+		    P[nt][j]   = (E[nt][j] - 0.5 * U[nt][j]*U[nt][j]) * (gamma - 1.0) * RHO[nt][j];
+		    h_mass += MASS[j];
+		}
+	    else // On Eulerian Coordinate
+		{
+		    Mom = RHO[nt][j]*U[nt][j] - nu*(F_u[j+1]  -F_u[j]);
+		    Ene = RHO[nt][j]*E[nt][j] - nu*(F_e[j+1]  -F_e[j]);
+		    RHO[nt][j]  =  RHO[nt][j] - nu*(F_rho[j+1]-F_rho[j]);
+
+		    U[nt][j] = Mom / RHO[nt][j];
+		    E[nt][j] = Ene / RHO[nt][j];
+		    P[nt][j] = (Ene - 0.5*Mom*U[nt][j])*(gamma-1.0);
+		    h_mass += RHO[nt][j];
+		}
+	    n_bad += P[nt][j] < eps || RHO[nt][j] < eps;
+	    h_mom += Mom;
+	    h_ene += Ene;
+	    h_rho_min = fmin(h_rho_min, RHO[nt][j]);
+	    h_p_min   = fmin(h_p_min, P[nt][j]);
+	    h_Ma_max  = fmax(h_Ma_max, fabs(U[nt][j])/sqrt(gamma*P[nt][j]/RHO[nt][j]));
+	    h_nan    += !isfinite(RHO[nt][j]) || !isfinite(P[nt][j]) || !isfinite(Mom);
+
+//============================compute the slopes============================
+	    if (order > 1)
+		{
+		    h_L = h_cell(el, h, X[nt], H, j);
+		    s_u[j]   = (    U_next[j+1] -     U_next[j])/h_L;
+		    s_p[j]   = (    P_next[j+1] -     P_next[j])/h_L;
+		    if (el == LAG)
+			s_rho[j] = (RHO_next_L[j+1] - RHO_next_R[j])/h_L;
+		    else
+			s_rho[j] = (RHO_next_L[j+1] - RHO_next_L[j])/h_L;
+		}
+	}
+    if(n_bad)
+	{
+	    for(j = 0; j < m; ++j)
+		if(P[nt][j] < eps || RHO[nt][j] < eps)
+		    printf("<0.0 error on [%d, %d] (t_n, x) - Update\n", k, j);
+	    stop_t = true;
+	}
+
+//============================Time update=======================
+
+    time_c += tau;
+    if(isfinite(t_all))
+        DispPro(time_c*100.0/t_all, k);
+    else
+        DispPro(k*100.0/N, k);
+    if (el == EUL)
+	hv = (struct health_var){h_mass*h, h_mom*h, 0.0, h_ene*h, h_rho_min, h_p_min, h_Ma_max, h_nan};
+    else
+	hv = (struct health_var){h_mass, h_mom, 0.0, h_ene, h_rho_min, h_p_min, h_Ma_max, h_nan};
+    if (health && health_check(&hv, k, time_c))
+	stop_t = true;
+    if(stop_t || time_c > (t_all - eps) || !isfinite(time_c))
+	break;
+
+//===========================Fixed variable location=======================
+
+#ifdef _OPENMP
+    toc = omp_get_wtime();
+#else
+    toc = (double)clock() / (double)CLOCKS_PER_SEC;
+#endif
+    cpu_time_sum += toc - tic;
+    cpu_time[nt]  = cpu_time_sum;
+  }
+
+  printf("\nTime is up at time step %d.\n", k);
+  printf("The cost of CPU time for 1D-%s %s scheme for this problem is %g seconds.\n",
+	 order > 1 ? "GRP" : "Godunov", el == LAG ? "Lagrangian" : (el == ALE ? "ALE" : "Eulerian"), cpu_time_sum);
+//---------------------END OF THE MAIN LOOP----------------------
+
+return_NULL:
+  config[5] = (double)k;
+  *N_plot = nt+1;
+  if(isfinite(time_c))
+      time_plot[nt] = time_c;
+  else if(isfinite(t_all))
+      time_plot[nt] = t_all;
+  else if(isfinite(tau))
+      time_plot[nt] = k*tau;
+
+  free(buffer);
+  free(out);
+  free(hv_b);
+  buffer = NULL;
+  out    = NULL;
+  hv_b   = NULL;
+}
+
+
+/**
+ * @brief This function use Godunov/GRP scheme to solve 1-D Euler
+ *        equations of motion on Eulerian/Lagrangian/ALE coordinate.
+ * @details The coordinate framework is 'config[8]' and the order of the scheme is 'config[9]'.
+ *          The mesh motion strategy on ALE coordinate is 'config[45]'.
+ * @param[in] m:          Number of the grids.
+ * @param[in,out] CV:     Structure of cell variable data.
+ * @param[in,out] X[]:    Array of the coordinate data.
+ * @param[out] cpu_time:  Array of the CPU time recording.
+ * @param[in,out] N_plot: Pointer to the number of time steps for plotting.
+ * @param[in,out] time_plot: Array of the plotting time recording.
+ * @return    Whether the framework and the order are supported.
+ */
+_Bool finite_volume_scheme_1D(const int m, struct cell_var_stru CV, double * X[], double * cpu_time, int * N_plot, double time_plot[])
+{
+    const int el    = (int)config[8];
+    const int order = (int)config[9];
+
+    if (el == EUL && order == 1)
+	scheme_1D(EUL, 1, m, CV, X, cpu_time, N_plot, time_plot);
+    else if (el == EUL && order == 2)
+	scheme_1D(EUL, 2, m, CV, X, cpu_time, N_plot, time_plot);
+    else if (el == LAG && order == 1)
+	scheme_1D(LAG, 1, m, CV, X, cpu_time, N_plot, time_plot);
+    else if (el == LAG && order == 2)
+	scheme_1D(LAG, 2, m, CV, X, cpu_time, N_plot, time_plot);
+    else if (el == ALE && order == 1)
+	scheme_1D(ALE, 1, m, CV, X, cpu_time, N_plot, time_plot);
+    else if (el == ALE && order == 2)
+	scheme_1D(ALE, 2, m, CV, X, cpu_time, N_plot, time_plot);
+    else
+	return false;
+    return true;
+}
@@ -10,11 +10,14 @@
 #include <time.h>
 #include <stdbool.h>
 
+#include "../include_cii/mem.h"
 #include "../include/var_struc.h"
 #include "../include/tools.h"
 #include "../include/file_io.h"
+#include "../include/inter_process.h"
 #include "../include/inter_process_unstruct.h"
 #include "../include/flux_calc.h"
+#include "../include/riemann_solver.h"
 
 
 /**
@@ -37,40 +40,76 @@ void finite_volume_scheme_unstruct(struct flu_var * FV, const struct mesh_var *
 	double const t_all =      config[1];  // the total time
 	double const eps   =      config[4];  // the largest value could be seen as zero
 	double       tau   =      config[16]; // the length of the time step
+	_Bool const Quiescent = (_Bool)config[51]; // whether quiescent interfaces skip the Riemann solvers
 
 	clock_t start_clock;
 	double cpu_time = 0.0;
 
 	int ** cp = mv->cell_pt;
+	const int n_x = mv->n_x; // > 0 on a logically structured quadrilateral mesh with the implicit (i, j) connectivity
 
 	struct cell_var cv;
+	double tic = wall_time();
 	cell_mem_init_free(&cv, mv, FV, 1); // Initialize memory
 
 	cons_qty_init(&cv, FV);
+	tic = wall_time_stage("initializing the cell variables", tic);
 
 	vol_comp(&cv, mv);
+	tic = wall_time_stage("computing the cell volumes", tic);
 
 	cell_rel(&cv, mv);
+	tic = wall_time_stage("computing the interfacial normals", tic);
 
 	if (order > 1)
-		cell_centroid(&cv, mv);
+		{
+			cell_centroid(&cv, mv);
+			wall_time_stage("computing the cell centroids", tic);
+		}
 
 	printf("Unstructured grid has been constructed.\n");
+	if (cv.pack != NULL)
+		printf("Packed per-cell state in blocks of %d grid cells.\n", CELL_PACK_W);
+	Mem_stat_print();
 
 	struct i_f_var ifv, ifv_R;
+	struct health_var hv;
+	const _Bool health = (_Bool)config[38];
 	double time_c = 0.0;
 	_Bool stop_t = false;
 	int i, ivi, RK = 0, N_count = 0;
+#ifdef ROOFLINE
+	int num_edge = 0; // the number of cell interfaces swept by the loops over the edges of each cell
+	for(int k = 0; k < num_cell; k++)
+		num_edge += cp[k][0];
+#endif
 	for(i = 1; i <= N; ++i)
 		{
 			start_clock = clock();
 			if (time_c >= time_plot[N_count] && N_count < (*N_plot-1))
 				{
 					file_write_2D_BLOCK_TEC(*FV, *mv, problem, time_plot[N_count]);
+#ifndef NOVTKPLOT
+					if ((int)config[34])
+						file_write_2D_VTU(*FV, *mv, problem, time_plot[N_count]);
+#endif
 					N_count++;
 				}
 
-			fluid_var_update(FV, &cv);
+			if (!fluid_var_update(FV, &cv, health ? &hv : NULL))
+				{
+					i--;
+					break;
+				}
+			if (!RK)
+				{
+					if (health && health_check(&hv, i-1, time_c))
+						{
+							i--;
+							break;
+						}
+					insitu_2D_unstruct(&cv, mv, problem, i-1, time_c, false);
+				}
 
 			if (order > 1)
 				{
@@ -79,14 +118,22 @@ void finite_volume_scheme_unstruct(struct flu_var * FV, const struct mesh_var *
 					if (mv->bc != NULL)
 						mv->bc(&cv, mv, FV, time_c);
 					if (!(int)config[31])
-						slope_limiter_prim(&cv, mv, FV);
+						{
+							TL_BEGIN(tl_lim);
+							slope_limiter_prim(&cv, mv, FV);
+							RL_END("limiter", tl_lim, RL_LIMITER_UNSTRUCT, num_cell, num_edge);
+						}
 				}
 			if (mv->bc != NULL)
 				mv->bc(&cv, mv, FV, time_c);
+			if (cv.pack != NULL)
+				cell_pack_update(&cv, mv);
 
 			if(isfinite(t_all) || !isfinite(config[16]) || config[16] <= 0.0 || !RK)
 			    {
+				TL_BEGIN(tl_cfl);
 				tau = tau_calc(&cv, mv);
+				RL_END("CFL", tl_cfl, RL_CFL_UNSTRUCT, num_cell, num_edge);
 				if(tau < eps)
 				    {
 					printf("\nThe length of the time step is so small on [%d, %g, %g] (t_n, time_c, tau)\n", i, time_c, tau);
@@ -104,17 +151,23 @@ void finite_volume_scheme_unstruct(struct flu_var * FV, const struct mesh_var *
 				    }
 			    }
 
+			TL_BEGIN(tl_flux);
 			for(int k = 0; k < num_cell; k++)
 				{
-					for(int j = 0; j < cp[k][0]; j++)
+					for(int j = 0; j < (n_x > 0 ? 4 : cp[k][0]); j++)
 						{
-							ivi = interface_var_init(&cv, mv, &ifv, &ifv_R, k, j, i, 0.0);
+							if (n_x > 0)
+								ivi = interface_var_init_ij(&cv, mv, &ifv, &ifv_R, k%n_x, k/n_x, j, i, 0.0);
+							else
+								ivi = interface_var_init(&cv, mv, &ifv, &ifv_R, k, j, i, 0.0);
 							// ivi = interface_var_init(&cv, mv, &ifv, &ifv_R, k, j, i, 1.0/sqrt(3));
 							if(ivi == 0)
 								stop_t = true;
 							else if (ivi == 1)
 								{
-									if (order == 1)
+									if (Quiescent && quiescent_check(&ifv, &ifv_R, order == 2))
+										uniform_2D_flux(&ifv);
+									else if (order == 1)
 										{
 											if (strcmp(scheme,"Roe") == 0)
 												Roe_flux(&ifv, &ifv_R);
@@ -165,9 +218,13 @@ void finite_volume_scheme_unstruct(struct flu_var * FV, const struct mesh_var *
 						}
 				}
 
+			RL_END("flux", tl_flux, RL_FLUX_UNSTRUCT, num_cell, num_edge);
+
 			// cons_qty_update(&cv, mv, *FV, tau);
+			TL_BEGIN(tl_upd);
 			if (cons_qty_update_corr_ave_P(&cv, mv, FV, tau, RK) == 0)
 			    stop_t = true;
+			RL_END("update", tl_upd, RL_UPDATE_UNSTRUCT, num_cell, num_edge);
 
 			if((_Bool)config[53])
 			    RK = RK ? 0 : 1;
@@ -184,6 +241,12 @@ void finite_volume_scheme_unstruct(struct flu_var * FV, const struct mesh_var *
 		}
 	printf("\nTime is up at time step %d.\n", i);
 	printf("\nThe cost of CPU time for the finite volume scheme on unstructured grids in Eulerian coordinate is %g seconds.\n", cpu_time);
+	if (config[52] >= 1.0)
+		{
+			long long AIRS_num[3];
+			Riemann_solver_adaptive_count(AIRS_num);
+			printf("Riemann problems solved by PVRS/TRRS/exact Riemann solver: %lld/%lld/%lld\n", AIRS_num[0], AIRS_num[1], AIRS_num[2]);
+		}
 
 return_NULL:
 	config[5] = (double)i;
@@ -195,6 +258,7 @@ return_NULL:
   else if(isfinite(tau))
       time_plot[N_count] = i*tau;
 
-	fluid_var_update(FV, &cv);
+	fluid_var_update(FV, &cv, NULL);
+	insitu_2D_unstruct(&cv, mv, problem, i > N ? N : i, time_c, true);
 	cell_mem_init_free(&cv, mv, FV, 0);
 }
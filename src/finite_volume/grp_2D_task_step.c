@@ -0,0 +1,307 @@
+/**
+ * @file  grp_2D_task_step.c
+ * @brief This is a time step of Eulerian GRP schemes for 2-D Euler equations on structured grids by an OpenMP task graph.
+ * @details The grid is cut into tiles of config[55]*config[55] grid cells, or of the edge tuned by omp_tune_begin().
+ *          The boundary conditions and slope limiters of a block of rows (x-direction) or columns (y-direction), the fluxes on the interfaces of a tile and
+ *          the update of a tile are tasks, whose dependencies only involve the neighbouring blocks and tiles.
+ *          So the interfacial fluxes of a tile start as soon as its slopes are ready, the boundary blocks run
+ *          concurrently with the interior, and the update of a tile starts as soon as its fluxes are done,
+ *          instead of waiting for the implicit barrier at the end of each phase.
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <stdbool.h>
+
+#include "../include_cii/mem.h"
+#include "../include/var_struc.h"
+#include "../include/flux_calc.h"
+#include "../include/inter_process.h"
+#include "../include/tools.h"
+#include "../include/finite_volume.h"
+
+
+/**
+ * @brief This function updates the fluid variables and the slopes of the grid cells [j_0, j_1)*[i_0, i_1).
+ * @param[in] n:      Number of the y-grids: n_y.
+ * @param[in] nt:     Current plot time step for computing updates of conservative variables.
+ * @param[in] k:      Serial number of the time step, only for the error message.
+ * @param[in,out] CV: Structure of cell variable data.
+ * @param[in] nu:     tau/h_x of the update, 0.0 if there is no x-flux in the update.
+ * @param[in] mu:     tau/h_y of the update, 0.0 if there is no y-flux in the update.
+ * @param[in] j_0, j_1: Range of the x-indices of the grid cells.
+ * @param[in] i_0, i_1: Range of the y-indices of the grid cells.
+ * @param[out] W_old:   Array of the primitive variables saved before the update, NULL without first-order fallback.
+ * @param[out] trouble: Array of troubled grid cell indicators, NULL without first-order fallback.
+ * @param[out] hv:    Sums of the conservative variables, extrema and number of grid cells with NAN of the tile,
+ *                    the square of the maximum Mach number is kept in 'Ma_max'.
+ * @return    Number of grid cells with density or pressure < eps.
+ */
+static int update_tile(const int n, const int nt, const int k, struct cell_var_stru * CV, const double nu, const double mu,
+		       const int j_0, const int j_1, const int i_0, const int i_1,
+		       double * W_old, char * trouble, struct health_var * hv)
+{
+    double const eps   = config[4];  // the largest value could be seen as zero
+    double const gamma = config[6];  // the constant of the perfect gas
+    double const h_x   = config[10]; // the length of the initial x-spatial grids
+    double const h_y   = config[11]; // the length of the initial y-spatial grids
+    double mom_x, mom_y, ene, d_rho;
+    double h_rho = 0.0, h_mom_x = 0.0, h_mom_y = 0.0, h_ene = 0.0, h_rho_min = INFINITY, h_p_min = INFINITY, h_Ma2 = 0.0;
+    int i, j, h_nan = 0, n_bad = 0;
+
+    for(j = j_0; j < j_1; ++j)
+	for(i = i_0; i < i_1; ++i)
+	    {
+		if(W_old)
+		    {
+			W_old[4*(j*n+i)]   = CV[nt].RHO[j][i];
+			W_old[4*(j*n+i)+1] =   CV[nt].U[j][i];
+			W_old[4*(j*n+i)+2] =   CV[nt].V[j][i];
+			W_old[4*(j*n+i)+3] =   CV[nt].P[j][i];
+		    }
+		mom_x = CV[nt].RHO[j][i]*CV[nt].U[j][i];
+		mom_y = CV[nt].RHO[j][i]*CV[nt].V[j][i];
+		ene   = CV[nt].RHO[j][i]*CV[nt].E[j][i];
+		d_rho = 0.0;
+		if(nu > 0.0)
+		    {
+			mom_x -= nu*(CV->F_u[j+1][i]  -CV->F_u[j][i]);
+			mom_y -= nu*(CV->F_v[j+1][i]  -CV->F_v[j][i]);
+			ene   -= nu*(CV->F_e[j+1][i]  -CV->F_e[j][i]);
+			d_rho  = - nu*(CV->F_rho[j+1][i]-CV->F_rho[j][i]);
+		    }
+		if(mu > 0.0)
+		    {
+			mom_x -= mu*(CV->G_u[j][i+1]  -CV->G_u[j][i]);
+			mom_y -= mu*(CV->G_v[j][i+1]  -CV->G_v[j][i]);
+			ene   -= mu*(CV->G_e[j][i+1]  -CV->G_e[j][i]);
+			d_rho -= mu*(CV->G_rho[j][i+1]-CV->G_rho[j][i]);
+		    }
+		CV[nt].RHO[j][i] += d_rho;
+
+		CV[nt].U[j][i] = mom_x / CV[nt].RHO[j][i];
+		CV[nt].V[j][i] = mom_y / CV[nt].RHO[j][i];
+		CV[nt].E[j][i] = ene   / CV[nt].RHO[j][i];
+		CV[nt].P[j][i] = (ene - 0.5*mom_x*CV[nt].U[j][i] - 0.5*mom_y*CV[nt].V[j][i])*(gamma-1.0);
+		if(CV[nt].P[j][i] < eps || CV[nt].RHO[j][i] < eps || (W_old && !isfinite(CV[nt].P[j][i])))
+		    {
+			if(W_old)
+			    trouble[j*n+i] = 1;
+			else
+			    printf("<0.0 error on [%d, %d, %d] (t_n, x, y) - Update\n", k, j, i);
+			n_bad++;
+		    }
+		h_rho   += CV[nt].RHO[j][i];
+		h_mom_x += mom_x;
+		h_mom_y += mom_y;
+		h_ene   += ene;
+		h_rho_min = fmin(h_rho_min, CV[nt].RHO[j][i]);
+		h_p_min   = fmin(h_p_min,   CV[nt].P[j][i]);
+		h_Ma2     = fmax(h_Ma2, (CV[nt].U[j][i]*CV[nt].U[j][i] + CV[nt].V[j][i]*CV[nt].V[j][i])*CV[nt].RHO[j][i]/(gamma*CV[nt].P[j][i]));
+		h_nan    += !isfinite(CV[nt].RHO[j][i]) || !isfinite(CV[nt].P[j][i]) || !isfinite(mom_x) || !isfinite(mom_y);
+
+		if(nu > 0.0)
+		    {
+			CV->s_rho[j][i] = (CV->rhoIx[j+1][i] - CV->rhoIx[j][i])/h_x;
+			CV->s_u[j][i]   = (  CV->uIx[j+1][i] -   CV->uIx[j][i])/h_x;
+			CV->s_v[j][i]   = (  CV->vIx[j+1][i] -   CV->vIx[j][i])/h_x;
+			CV->s_p[j][i]   = (  CV->pIx[j+1][i] -   CV->pIx[j][i])/h_x;
+		    }
+		if(mu > 0.0)
+		    {
+			CV->t_rho[j][i] = (CV->rhoIy[j][i+1] - CV->rhoIy[j][i])/h_y;
+			CV->t_u[j][i]   = (  CV->uIy[j][i+1] -   CV->uIy[j][i])/h_y;
+			CV->t_v[j][i]   = (  CV->vIy[j][i+1] -   CV->vIy[j][i])/h_y;
+			CV->t_p[j][i]   = (  CV->pIy[j][i+1] -   CV->pIy[j][i])/h_y;
+		    }
+	    }
+    *hv = (struct health_var){h_rho, h_mom_x, h_mom_y, h_ene, h_rho_min, h_p_min, h_Ma2, h_nan};
+    return n_bad;
+}
+
+
+/**
+ * @brief This function advances the fluid variables by a time step of 2-D GRP scheme through an OpenMP task graph on tiles.
+ * @details The boundary conditions should have been found by bound_cond_slope_limiter_x() and bound_cond_slope_limiter_y().
+ *          The tasks and their dependencies are
+ *          - BC_x(R)/BC_y(C): boundary conditions and slope limiter of the block R of rows/block C of columns;
+ *          - TR_x/TR_y: slopes of the ghost grid cells for the transversal terms, after the first and last blocks;
+ *          - F_x(R,C): x-fluxes of the tile, after BC_x(R) (and BC_y(C-1), BC_y(C), TR_y with transversal terms);
+ *          - F_y(R,C): y-fluxes of the tile, after BC_y(C) (and BC_x(R-1), BC_x(R), TR_x with transversal terms);
+ *          - U(R,C): update of the tile, after F_x(R,C), F_x(R,C+1), F_y(R,C), F_y(R+1,C),
+ *            which are all the tasks reading the fluid variables or the slopes of the tile.
+ *          The sums for the health monitor are accumulated tile by tile in a fixed order.
+ * @param[in] m:      Number of the x-grids: n_x.
+ * @param[in] n:      Number of the y-grids: n_y.
+ * @param[in] nt:     Current plot time step for computing updates of conservative variables.
+ * @param[in] k:      Serial number of the time step, only for the error messages.
+ * @param[in,out] CV: Structure of cell variable data.
+ * @param[in] bfv_L, bfv_R, bfv_D, bfv_U: Fluid variables at left/right/downside/upper boundary.
+ * @param[in] tau_x:  The length of the time step of x-fluxes, 0.0 if there is no x-flux in the update.
+ * @param[in] tau_y:  The length of the time step of y-fluxes, 0.0 if there is no y-flux in the update.
+ * @param[in] Transversal: Whether the tangential effect is considered.
+ * @param[out] W_old:   Array of the primitive variables saved before the update, NULL without first-order fallback.
+ * @param[out] trouble: Array of troubled grid cell indicators, NULL without first-order fallback.
+ * @param[out] hv:      Structure of the health monitor variables, NULL if not needed.
+ * @param[out] n_trouble: Number of grid cells with density or pressure < eps.
+ * @return    miscalculation indicator of the fluxes as flux_generator_x(), an error of left/right states takes precedence.
+ */
+int GRP_2D_task_step(const int m, const int n, const int nt, const int k, struct cell_var_stru * CV,
+		     const struct b_f_var * bfv_L, const struct b_f_var * bfv_R, const struct b_f_var * bfv_D, const struct b_f_var * bfv_U,
+		     const double tau_x, const double tau_y, const _Bool Transversal,
+		     double * W_old, char * trouble, struct health_var * hv, int * n_trouble)
+{
+    double const h_x = config[10]; // the length of the initial x-spatial grids
+    double const h_y = config[11]; // the length of the initial y-spatial grids
+    double const nu  = tau_x / h_x, mu = tau_y / h_y;
+    int const tile = omp_tune_begin(TUNE_TILE); // config[55] or the tuned edge
+    int const bs  = tile > N_GHOST ? tile : N_GHOST; // the edge of the tiles
+    int const nbx = (m + bs - 1) / bs, nby = (n + bs - 1) / bs;
+    int const last_x = nbx - 1, last_y = nby - 1;
+    int R, C, T, flux_err = 0;
+
+    // dependency objects of the tasks BC_x, TR_x, BC_y, TR_y, F_x and F_y
+    int const BX = 0, TX = nby, BY = nby+1, TY = BY+nbx, FX = TY+1, FY = FX+nbx*nby;
+    char * dep = (char *)ALLOC_TAG(FY+nbx*nby, "task graph");
+#ifndef _OPENMP
+    (void)BX; (void)TX;
+#endif
+    // results of the tasks
+    int * err = (int *)ALLOC_TAG(2*nbx*nby * sizeof(int), "task graph");
+    int * bad = (int *)ALLOC_TAG(nbx*nby * sizeof(int), "task graph");
+    struct health_var * sum = (struct health_var *)ALLOC_TAG(nbx*nby * sizeof(struct health_var), "task graph");
+
+#ifdef _OPENMP
+#pragma omp parallel
+#pragma omp single
+#endif
+    {
+	if(tau_x > 0.0)
+	    for(R = 0; R < nby; ++R)
+		{
+#ifdef _OPENMP
+#pragma omp task firstprivate(R) depend(out: dep[BX+R])
+#endif
+		    {
+			TL_BEGIN(tl);
+			bound_cond_slope_limiter_x_rows(m, n, nt, CV, bfv_L, bfv_R, true, true, R*bs, R < last_y ? R*bs+bs : n);
+			TL_END("limiter x task", tl);
+		    }
+		}
+	if(tau_y > 0.0)
+	    for(C = 0; C < nbx; ++C)
+		{
+#ifdef _OPENMP
+#pragma omp task firstprivate(C) depend(out: dep[BY+C])
+#endif
+		    {
+			TL_BEGIN(tl);
+			bound_cond_slope_limiter_y_cols(m, n, nt, CV, bfv_D, bfv_U, true, true, C*bs, C < last_x ? C*bs+bs : m);
+			TL_END("limiter y task", tl);
+		    }
+		}
+	if(Transversal)
+	    {
+		// the last N_GHOST rows/columns may reach the last but one block
+#ifdef _OPENMP
+#pragma omp task depend(in: dep[BX+0], dep[BX+last_y], dep[BX+(last_y ? last_y-1 : 0)]) depend(out: dep[TX])
+#endif
+		{
+		    TL_BEGIN(tl);
+		    ghost_slope_x_trans(m, n, CV);
+		    TL_END("transversal x task", tl);
+		}
+#ifdef _OPENMP
+#pragma omp task depend(in: dep[BY+0], dep[BY+last_x], dep[BY+(last_x ? last_x-1 : 0)]) depend(out: dep[TY])
+#endif
+		{
+		    TL_BEGIN(tl);
+		    ghost_slope_y_trans(m, n, CV);
+		    TL_END("transversal y task", tl);
+		}
+	    }
+
+	if(tau_x > 0.0)
+	    for(R = 0; R < nby; ++R)
+		for(C = 0; C < nbx; ++C)
+		    {
+#ifdef _OPENMP
+#pragma omp task firstprivate(R, C) depend(in: dep[BX+R], dep[BY+C], dep[BY+(C ? C-1 : C)], dep[BY+(C == 0 || C == last_x ? TY-BY : C)]) \
+    depend(out: dep[FX+R*nbx+C])
+#endif
+			{
+			    TL_BEGIN(tl);
+			    err[R*nbx+C] = flux_generator_x_tile(nt, tau_x, CV, Transversal, C*bs, C < last_x ? C*bs+bs : m+1,
+								 R*bs, R < last_y ? R*bs+bs : n);
+			    TL_END("flux x task", tl);
+			}
+		    }
+	if(tau_y > 0.0)
+	    for(C = 0; C < nbx; ++C)
+		for(R = 0; R < nby; ++R)
+		    {
+#ifdef _OPENMP
+#pragma omp task firstprivate(R, C) depend(in: dep[BY+C], dep[BX+R], dep[BX+(R ? R-1 : R)], dep[BX+(R == 0 || R == last_y ? TX-BX : R)]) \
+    depend(out: dep[FY+R*nbx+C])
+#endif
+			{
+			    TL_BEGIN(tl);
+			    err[nbx*nby+R*nbx+C] = flux_generator_y_tile(nt, tau_y, CV, Transversal, C*bs, C < last_x ? C*bs+bs : m,
+									 R*bs, R < last_y ? R*bs+bs : n+1);
+			    TL_END("flux y task", tl);
+			}
+		    }
+
+	for(R = 0; R < nby; ++R)
+	    for(C = 0; C < nbx; ++C)
+		{
+#ifdef _OPENMP
+#pragma omp task firstprivate(R, C) depend(in: dep[FX+R*nbx+C], dep[FX+(R*nbx+(C < last_x ? C+1 : C))], \
+					       dep[FY+R*nbx+C], dep[FY+((R < last_y ? R+1 : R)*nbx+C)])
+#endif
+		    {
+			TL_BEGIN(tl);
+			bad[R*nbx+C] = update_tile(n, nt, k, CV, nu, mu, C*bs, C < last_x ? C*bs+bs : m, R*bs, R < last_y ? R*bs+bs : n,
+						   W_old, trouble, sum + R*nbx+C);
+			TL_END("update task", tl);
+		    }
+		}
+    } // End of parallel region
+
+    *n_trouble = 0;
+    for(T = 0; T < nbx*nby; ++T)
+	{
+	    if(tau_x > 0.0 && err[T] && flux_err != 1)
+		flux_err = err[T];
+	    if(tau_y > 0.0 && err[nbx*nby+T] && flux_err != 1)
+		flux_err = err[nbx*nby+T];
+	    *n_trouble += bad[T];
+	}
+    if(hv)
+	{
+	    *hv = sum[0];
+	    for(T = 1; T < nbx*nby; ++T)
+		{
+		    hv->mass   += sum[T].mass;
+		    hv->mom_x  += sum[T].mom_x;
+		    hv->mom_y  += sum[T].mom_y;
+		    hv->ene    += sum[T].ene;
+		    hv->rho_min = fmin(hv->rho_min, sum[T].rho_min);
+		    hv->p_min   = fmin(hv->p_min,   sum[T].p_min);
+		    hv->Ma_max  = fmax(hv->Ma_max,  sum[T].Ma_max);
+		    hv->n_nan  += sum[T].n_nan;
+		}
+	    hv->mass  *= h_x*h_y;
+	    hv->mom_x *= h_x*h_y;
+	    hv->mom_y *= h_x*h_y;
+	    hv->ene   *= h_x*h_y;
+	    hv->Ma_max = sqrt(hv->Ma_max);
+	}
+
+    FREE(dep);
+    FREE(err);
+    FREE(bad);
+    FREE(sum);
+    omp_tune_end(TUNE_TILE);
+    return flux_err;
+}
@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <time.h>
 #include <stdbool.h>
+#include <string.h>
 #ifdef _OPENACC
 #include <omp.h>
 #include <openacc.h>
@@ -15,12 +16,14 @@
 #include <omp.h>
 #endif
 
+#include "../include_cii/mem.h"
 #include "../include/var_struc.h"
 #include "../include/riemann_solver.h"
 #include "../include/flux_calc.h"
 #include "../include/inter_process.h"
 #include "../include/tools.h"
 #include "../include/file_io.h"
+#include "../include/finite_volume.h"
 
 
 /**
@@ -28,23 +31,17 @@
  */
 #define INIT_MEM_2D(v, M, N)						\
     do {								\
-	CV->v = (double **)malloc((M) * sizeof(double *));			\
-	if(CV->v == NULL)							\
-	    {								\
-		printf("NOT enough memory! %s\n", #v);			\
-		goto return_NULL;					\
-	    }								\
+	CV->v = (double **)ALLOC_TAG((M) * sizeof(double *), "per-edge arrays"); \
 	for(j = 0; j < (M); ++j)					\
-	    {								\
-		CV->v[j] = (double *)malloc((N) * sizeof(double));		\
-		if(CV->v[j] == NULL)					\
-		    {							\
-			printf("NOT enough memory! %s[%d]\n", #v, j);	\
-			goto return_NULL;				\
-		    }							\
-	    }								\
+	    CV->v[j] = (double *)ALLOC_TAG((N) * sizeof(double), "per-edge arrays"); \
     } while (0)
 
+/**
+ * @brief M*N memory allocations with N_GHOST ghost layers to the variable 'v' in the structure cell_var_stru.
+ */
+#define GHOST_INIT_MEM_2D(v, M, N)					\
+    (CV->v = ghost_mem_2D((M), (N), N_GHOST))
+
 /**
  * @brief M memory allocations to the structure variable b_f_var 'bfv'.
  */
@@ -77,6 +74,8 @@ void GRP_solver_2D_split_EUL_source(const int m, const int n, struct cell_var_st
 {
 #ifdef _OPENMP
   printf("@@ Number of threads for OpenMP: %d\n", omp_get_max_threads());
+  if ((int)config[55] > 0)
+    printf("@@ OpenMP task graph on tiles of %d*%d grid cells.\n", (int)config[55], (int)config[55]);
 #endif
 #ifdef _OPENACC
   printf("@@ Number of CPU devices for OpenACC: %d\n", acc_get_num_devices(acc_device_host));
@@ -105,9 +104,21 @@ void GRP_solver_2D_split_EUL_source(const int m, const int n, struct cell_var_st
   int flux_err;
 
   double mom_x, mom_y, ene;
+  // health monitor variables reduced in the update loop
+  const _Bool health = (_Bool)config[38];
+  struct health_var hv;
+  double h_rho, h_mom_x, h_mom_y, h_ene, h_rho_min, h_p_min, h_Ma2;
+  int h_nan;
+  // a posteriori first-order fallback of troubled cells
+  const _Bool mood = (_Bool)config[44];
+  double * W_old = NULL; // primitive variables before the update
+  char * trouble = NULL; // troubled cell indicators
+  int n_trouble;
   double c; // the speeds of sound
 
   double half_tau, half_nu, mu;  // nu = tau/h_x, mu = tau/h_y.
+  int const task_tile = (int)config[55]; // the edge of the tiles of the task graph
+  int n_thread; // the number of threads of the update loop
 
   double h_S_max, sigma; // h/S_max, S_max is the maximum character speed, sigma is the character speed
   double time_c = 0.0; // the current time
@@ -118,10 +129,10 @@ void GRP_solver_2D_split_EUL_source(const int m, const int n, struct cell_var_st
   // Left/Right/Upper/Downside boundary condition
   struct b_f_var * bfv_L = NULL, * bfv_R = NULL, * bfv_U = NULL, * bfv_D = NULL;
   // the slopes of variable values.
-  INIT_MEM_2D(s_rho, m, n); INIT_MEM_2D(t_rho, m, n);
-  INIT_MEM_2D(s_u,   m, n); INIT_MEM_2D(t_u,   m, n);
-  INIT_MEM_2D(s_v,   m, n); INIT_MEM_2D(t_v,   m, n);
-  INIT_MEM_2D(s_p,   m, n); INIT_MEM_2D(t_p,   m, n);
+  GHOST_INIT_MEM_2D(s_rho, m, n); GHOST_INIT_MEM_2D(t_rho, m, n);
+  GHOST_INIT_MEM_2D(s_u,   m, n); GHOST_INIT_MEM_2D(t_u,   m, n);
+  GHOST_INIT_MEM_2D(s_v,   m, n); GHOST_INIT_MEM_2D(t_v,   m, n);
+  GHOST_INIT_MEM_2D(s_p,   m, n); GHOST_INIT_MEM_2D(t_p,   m, n);
   // the variable values at (x_{j-1/2}, t_{n+1}).
   INIT_MEM_2D(rhoIx, m+1, n);
   INIT_MEM_2D(uIx,   m+1, n);
@@ -143,6 +154,14 @@ void GRP_solver_2D_split_EUL_source(const int m, const int n, struct cell_var_st
   // boundary condition
   BC_INIT_MEM_1D(bfv_L, n); BC_INIT_MEM_1D(bfv_R, n);
   BC_INIT_MEM_1D(bfv_D, m); BC_INIT_MEM_1D(bfv_U, m);
+  if(mood)
+      {
+	  W_old   = (double *)ALLOC_TAG(4 * (long)m * n * sizeof(double), "fields");
+	  trouble = (char *)CALLOC_TAG((long)m * n, sizeof(char), "fields");
+      }
+
+  insitu_2D_stru(m, n, CV, X, Y, problem, 0, time_c, false);
+  omp_tune_init(m, n);
 
 //------------THE MAIN LOOP-------------
   for(k = 1; k <= N; DS ? k : ++k)
@@ -156,6 +175,7 @@ void GRP_solver_2D_split_EUL_source(const int m, const int n, struct cell_var_st
 #endif
     if (time_c >= time_plot[nt_plot] && nt_plot < (*N_plot-1))
 	{
+	    TL_BEGIN(tl_out);
 #ifndef NOTECPLOT
 	    file_2D_write_POINT_TEC(m, n, 1, CV + nt, X, Y, cpu_time, problem, time_plot + nt_plot);
 #endif
@@ -173,6 +193,7 @@ void GRP_solver_2D_split_EUL_source(const int m, const int n, struct cell_var_st
 			    }
 		    nt++;
 		}
+	    TL_END("output", tl_out);
 	}
 
     /* evaluate f and a at some grid points for the iteration
@@ -180,13 +201,14 @@ void GRP_solver_2D_split_EUL_source(const int m, const int n, struct cell_var_st
      * of the time step by (tau * speed_max)/h = CFL
      */
     if(DS) {
+    TL_BEGIN(tl_cfl);
     h_S_max = INFINITY; // h/S_max = INFINITY
 
     for(j = 0; j < m; ++j)
 	for(i = 0; i < n; ++i)
 	    {
-		c = sqrt(gamma * CV->P[j][i] / CV->RHO[j][i]);
-		sigma = fabs(c) + fabs(CV->U[j][i]) + fabs(CV->V[j][i]);
+		c = sqrt(gamma * CV[nt].P[j][i] / CV[nt].RHO[j][i]);
+		sigma = fabs(c) + fabs(CV[nt].U[j][i]) + fabs(CV[nt].V[j][i]);
 		h_S_max = fmin(h_S_max, fmin(h_x,h_y) / sigma);
 	    }
     // If no total time, use fixed tau and time step N.
@@ -209,22 +231,44 @@ void GRP_solver_2D_split_EUL_source(const int m, const int n, struct cell_var_st
     half_tau = tau * 0.5;
     half_nu = half_tau / h_x;
     mu = tau / h_y;
+    RL_END("CFL", tl_cfl, RL_CFL_2D, m*n, 0);
     }
 
-    find_bound_x = bound_cond_slope_limiter_x(m, n, nt, CV, bfv_L, bfv_R, bfv_D, bfv_U, find_bound_x, true, time_c);
+    if(task_tile > 0 && find_bound_x && find_bound_y) {
+    TL_BEGIN(tl_task_x);
+    flux_err = GRP_2D_task_step(m, n, nt, k, CV, bfv_L, bfv_R, bfv_D, bfv_U, half_tau, 0.0, false, W_old, trouble, NULL, &n_trouble);
+    RL_END("task step x", tl_task_x, RL_TASK_2D_X, m*n, (m+1)*n);
+    if(flux_err == 1)
+        goto return_NULL;
+    else if(flux_err == 2 && !mood)
+	stop_t = true;
+    if(n_trouble && !mood)
+	{
+	    stop_t = true;
+	    n_trouble = 0;
+	}
+    } else {
+    TL_BEGIN(tl_lim_x);
+    find_bound_x = bound_cond_slope_limiter_x(m, n, nt, CV, bfv_L, bfv_R, find_bound_x, true, time_c);
+    RL_END("limiter x", tl_lim_x, RL_LIMITER_2D, m*n, 0);
     if(!find_bound_x)
         goto return_NULL;
-    flux_err = flux_generator_x(m, n, nt, half_tau, CV, bfv_L, bfv_R, false);
+    TL_BEGIN(tl_flux_x);
+    flux_err = flux_generator_x(m, n, nt, half_tau, CV, false);
+    RL_END("flux x", tl_flux_x, RL_FLUX_2D_SPLIT, 0, (m+1)*n);
     if(flux_err == 1)
         goto return_NULL;
-    else if(flux_err == 2)
+    else if(flux_err == 2 && !mood)
 	stop_t = true;
 
 //===============THE CORE ITERATION=================
+    TL_BEGIN(tl_upd_x);
+    n_trouble = 0;
+    n_thread = omp_tune_begin(TUNE_UPDATE_X);
 #ifdef _OPENMP
-#pragma omp parallel for  private(mom_x, mom_y, ene) collapse(2)
+#pragma omp parallel for  num_threads(n_thread) schedule(runtime) private(mom_x, mom_y, ene) collapse(2) reduction(+:n_trouble)
 #elif defined _OPENACC
-#pragma acc parallel loop private(mom_x, mom_y, ene) collapse(2)
+#pragma acc parallel loop private(mom_x, mom_y, ene) collapse(2) reduction(+:n_trouble)
 #endif
     for(i = 0; i < n; ++i)
       for(j = 0; j < m; ++j)
@@ -233,6 +277,13 @@ void GRP_solver_2D_split_EUL_source(const int m, const int n, struct cell_var_st
 	 * j-1/2  j-1  j+1/2   j   j+3/2  j+1
 	 *   o-----X-----o-----X-----o-----X--...
 	 */
+	  if(mood)
+	      {
+		  W_old[4*(j*n+i)]   = CV[nt].RHO[j][i];
+		  W_old[4*(j*n+i)+1] =   CV[nt].U[j][i];
+		  W_old[4*(j*n+i)+2] =   CV[nt].V[j][i];
+		  W_old[4*(j*n+i)+3] =   CV[nt].P[j][i];
+	      }
 	  mom_x = CV[nt].RHO[j][i]*CV[nt].U[j][i] - half_nu*(CV->F_u[j+1][i]  -CV->F_u[j][i]);
 	  mom_y = CV[nt].RHO[j][i]*CV[nt].V[j][i] - half_nu*(CV->F_v[j+1][i]  -CV->F_v[j][i]);
 	  ene   = CV[nt].RHO[j][i]*CV[nt].E[j][i] - half_nu*(CV->F_e[j+1][i]  -CV->F_e[j][i]);
@@ -242,10 +293,18 @@ void GRP_solver_2D_split_EUL_source(const int m, const int n, struct cell_var_st
 	  CV[nt].V[j][i] = mom_y / CV[nt].RHO[j][i];
 	  CV[nt].E[j][i] = ene   / CV[nt].RHO[j][i];
 	  CV[nt].P[j][i] = (ene - 0.5*mom_x*CV[nt].U[j][i] - 0.5*mom_y*CV[nt].V[j][i])*(gamma-1.0);
-	  if(CV[nt].P[j][i] < eps || CV[nt].RHO[j][i] < eps)
+	  if(CV[nt].P[j][i] < eps || CV[nt].RHO[j][i] < eps || (mood && !isfinite(CV[nt].P[j][i])))
 	      {
-		  printf("<0.0 error on [%d, %d, %d] (t_n, x, y) - Update\n", k, j, i);
-		  stop_t = true;
+		  if(mood)
+		      {
+			  trouble[j*n+i] = 1;
+			  n_trouble++;
+		      }
+		  else
+		      {
+			  printf("<0.0 error on [%d, %d, %d] (t_n, x, y) - Update\n", k, j, i);
+			  stop_t = true;
+		      }
 	      }
 	  
 	  CV->s_rho[j][i] = (CV->rhoIx[j+1][i] - CV->rhoIx[j][i])/h_x;
@@ -253,26 +312,62 @@ void GRP_solver_2D_split_EUL_source(const int m, const int n, struct cell_var_st
 	  CV->s_v[j][i]   = (  CV->vIx[j+1][i] -   CV->vIx[j][i])/h_x;
 	  CV->s_p[j][i]   = (  CV->pIx[j+1][i] -   CV->pIx[j][i])/h_x;
       } // End of parallel region
+    omp_tune_end(TUNE_UPDATE_X);
+    RL_END("update x", tl_upd_x, RL_UPDATE_2D_X, m*n, 0);
+    }
+    if(n_trouble)
+	{
+	    TL_BEGIN(tl_mood_x);
+	    if(flux_fallback_2D(m, n, nt, half_nu, 0.0, CV, W_old, trouble))
+		stop_t = true;
+	    memset(trouble, 0, m * n * sizeof(char));
+	    TL_END("fallback", tl_mood_x);
+	}
 
     if(stop_t)
 	break;
 //==================================================
 
     if(DS) {
-    find_bound_y = bound_cond_slope_limiter_y(m, n, nt, CV, bfv_L, bfv_R, bfv_D, bfv_U, find_bound_y, true, time_c);
+    if(task_tile > 0 && find_bound_x && find_bound_y) {
+    TL_BEGIN(tl_task_y);
+    flux_err = GRP_2D_task_step(m, n, nt, k, CV, bfv_L, bfv_R, bfv_D, bfv_U, 0.0, tau, false, W_old, trouble, &hv, &n_trouble);
+    RL_END("task step y", tl_task_y, RL_TASK_2D_Y, m*n, m*(n+1));
+    if(flux_err == 1)
+        goto return_NULL;
+    else if(flux_err == 2 && !mood)
+	stop_t = true;
+    if(n_trouble && !mood)
+	{
+	    stop_t = true;
+	    n_trouble = 0;
+	}
+    } else {
+    TL_BEGIN(tl_lim_y);
+    find_bound_y = bound_cond_slope_limiter_y(m, n, nt, CV, bfv_D, bfv_U, find_bound_y, true, time_c);
+    RL_END("limiter y", tl_lim_y, RL_LIMITER_2D, m*n, 0);
     if(!find_bound_y)
         goto return_NULL;
-    flux_err = flux_generator_y(m, n, nt, tau, CV, bfv_D, bfv_U, false);
+    TL_BEGIN(tl_flux_y);
+    flux_err = flux_generator_y(m, n, nt, tau, CV, false);
+    RL_END("flux y", tl_flux_y, RL_FLUX_2D_SPLIT, 0, m*(n+1));
     if(flux_err == 1)
         goto return_NULL;
-    else if(flux_err == 2)
+    else if(flux_err == 2 && !mood)
 	stop_t = true;
 
 //===============THE CORE ITERATION=================
+    TL_BEGIN(tl_upd_y);
+    h_rho = h_mom_x = h_mom_y = h_ene = h_Ma2 = 0.0;
+    h_rho_min = h_p_min = INFINITY;
+    h_nan = n_trouble = 0;
+    n_thread = omp_tune_begin(TUNE_UPDATE_Y);
 #ifdef _OPENMP
-#pragma omp parallel for  private(mom_x, mom_y, ene) collapse(2)
+#pragma omp parallel for  num_threads(n_thread) schedule(runtime) private(mom_x, mom_y, ene) collapse(2) \
+reduction(+:h_rho, h_mom_x, h_mom_y, h_ene, h_nan, n_trouble) reduction(min:h_rho_min, h_p_min) reduction(max:h_Ma2)
 #elif defined _OPENACC
-#pragma acc parallel loop private(mom_x, mom_y, ene) collapse(2)
+#pragma acc parallel loop private(mom_x, mom_y, ene) collapse(2) \
+reduction(+:h_rho, h_mom_x, h_mom_y, h_ene, h_nan, n_trouble) reduction(min:h_rho_min, h_p_min) reduction(max:h_Ma2)
 #endif
     for(j = 0; j < m; ++j)
       for(i = 0; i < n; ++i)
@@ -281,6 +376,13 @@ void GRP_solver_2D_split_EUL_source(const int m, const int n, struct cell_var_st
 	 * j-1/2  j-1  j+1/2   j   j+3/2  j+1
 	 *   o-----X-----o-----X-----o-----X--...
 	 */
+	  if(mood)
+	      {
+		  W_old[4*(j*n+i)]   = CV[nt].RHO[j][i];
+		  W_old[4*(j*n+i)+1] =   CV[nt].U[j][i];
+		  W_old[4*(j*n+i)+2] =   CV[nt].V[j][i];
+		  W_old[4*(j*n+i)+3] =   CV[nt].P[j][i];
+	      }
 	  mom_x = CV[nt].RHO[j][i]*CV[nt].U[j][i] - mu*(CV->G_u[j][i+1]  -CV->G_u[j][i]);
 	  mom_y = CV[nt].RHO[j][i]*CV[nt].V[j][i] - mu*(CV->G_v[j][i+1]  -CV->G_v[j][i]);
 	  ene   = CV[nt].RHO[j][i]*CV[nt].E[j][i] - mu*(CV->G_e[j][i+1]  -CV->G_e[j][i]);
@@ -290,17 +392,45 @@ void GRP_solver_2D_split_EUL_source(const int m, const int n, struct cell_var_st
 	  CV[nt].V[j][i] = mom_y / CV[nt].RHO[j][i];
 	  CV[nt].E[j][i] = ene   / CV[nt].RHO[j][i];
 	  CV[nt].P[j][i] = (ene - 0.5*mom_x*CV[nt].U[j][i] - 0.5*mom_y*CV[nt].V[j][i])*(gamma-1.0);
-	  if(CV[nt].P[j][i] < eps || CV[nt].RHO[j][i] < eps)
+	  if(CV[nt].P[j][i] < eps || CV[nt].RHO[j][i] < eps || (mood && !isfinite(CV[nt].P[j][i])))
 	      {
-		  printf("<0.0 error on [%d, %d, %d] (t_n, x, y) - Update\n", k, j, i);
-		  stop_t = true;
+		  if(mood)
+		      {
+			  trouble[j*n+i] = 1;
+			  n_trouble++;
+		      }
+		  else
+		      {
+			  printf("<0.0 error on [%d, %d, %d] (t_n, x, y) - Update\n", k, j, i);
+			  stop_t = true;
+		      }
 	      }
+	  h_rho   += CV[nt].RHO[j][i];
+	  h_mom_x += mom_x;
+	  h_mom_y += mom_y;
+	  h_ene   += ene;
+	  h_rho_min = fmin(h_rho_min, CV[nt].RHO[j][i]);
+	  h_p_min   = fmin(h_p_min,   CV[nt].P[j][i]);
+	  h_Ma2     = fmax(h_Ma2, (CV[nt].U[j][i]*CV[nt].U[j][i] + CV[nt].V[j][i]*CV[nt].V[j][i])*CV[nt].RHO[j][i]/(gamma*CV[nt].P[j][i]));
+	  h_nan    += !isfinite(CV[nt].RHO[j][i]) || !isfinite(CV[nt].P[j][i]) || !isfinite(mom_x) || !isfinite(mom_y);
 	  
 	  CV->t_rho[j][i] = (CV->rhoIy[j][i+1] - CV->rhoIy[j][i])/h_y;
 	  CV->t_u[j][i]   = (  CV->uIy[j][i+1] -   CV->uIy[j][i])/h_y;
 	  CV->t_v[j][i]   = (  CV->vIy[j][i+1] -   CV->vIy[j][i])/h_y;
 	  CV->t_p[j][i]   = (  CV->pIy[j][i+1] -   CV->pIy[j][i])/h_y;
       } // End of parallel region
+    omp_tune_end(TUNE_UPDATE_Y);
+    hv = (struct health_var){h_rho*h_x*h_y, h_mom_x*h_x*h_y, h_mom_y*h_x*h_y, h_ene*h_x*h_y, h_rho_min, h_p_min, sqrt(h_Ma2), h_nan};
+    RL_END("update y", tl_upd_y, RL_UPDATE_2D_Y, m*n, 0);
+    }
+    if(n_trouble)
+	{
+	    TL_BEGIN(tl_mood_y);
+	    if(flux_fallback_2D(m, n, nt, 0.0, mu, CV, W_old, trouble))
+		stop_t = true;
+	    memset(trouble, 0, m * n * sizeof(char));
+	    TL_END("fallback", tl_mood_y);
+	}
 //==================================================
     
     time_c += tau;
@@ -308,6 +438,18 @@ void GRP_solver_2D_split_EUL_source(const int m, const int n, struct cell_var_st
         DispPro(time_c*100.0/t_all, k);
     else
         DispPro(k*100.0/N, k);
+    if (health)
+	{
+	    TL_BEGIN(tl_health);
+	    if (n_trouble)
+		health_sum_2D_stru(m, n, CV + nt, &hv);
+	    if (health_check(&hv, k, time_c))
+		stop_t = true;
+	    TL_END("health", tl_health);
+	}
+    TL_BEGIN(tl_insitu);
+    insitu_2D_stru(m, n, CV + nt, X, Y, problem, k, time_c, stop_t || time_c > (t_all - eps) || k == N);
+    TL_END("output", tl_insitu);
     }
     if(stop_t || time_c > (t_all - eps) || !isfinite(time_c))
 	break;
@@ -326,8 +468,15 @@ void GRP_solver_2D_split_EUL_source(const int m, const int n, struct cell_var_st
     cpu_time[nt]  = cpu_time_sum;
   }
 
+  omp_tune_save();
   printf("\nTime is up at time step %d.\n", k);
   printf("The cost of CPU time for 2D-GRP Eulerian scheme with dimension splitting for this problem is %g seconds.\n", cpu_time_sum);
+  if (config[52] >= 1.0)
+    {
+      long long AIRS_num[3];
+      Riemann_solver_adaptive_count(AIRS_num);
+      printf("Riemann problems solved by PVRS/TRRS/exact Riemann solver: %lld/%lld/%lld\n", AIRS_num[0], AIRS_num[1], AIRS_num[2]);
+    }
   //------------END OF THE MAIN LOOP-------------
   
 return_NULL:
@@ -342,31 +491,28 @@ return_NULL:
 
   for(j = 0; j < m+1; ++j)
   {
-    free(CV->F_rho[j]); free(CV->F_u[j]); free(CV->F_v[j]); free(CV->F_e[j]);
-    free(CV->rhoIx[j]); free(CV->uIx[j]); free(CV->vIx[j]); free(CV->pIx[j]);
+    FREE(CV->F_rho[j]); FREE(CV->F_u[j]); FREE(CV->F_v[j]); FREE(CV->F_e[j]);
+    FREE(CV->rhoIx[j]); FREE(CV->uIx[j]); FREE(CV->vIx[j]); FREE(CV->pIx[j]);
     CV->F_rho[j]= NULL; CV->F_u[j]= NULL; CV->F_v[j]= NULL; CV->F_e[j]= NULL;
     CV->rhoIx[j]= NULL; CV->uIx[j]= NULL; CV->vIx[j]= NULL; CV->pIx[j]= NULL;
   }
   for(j = 0; j < m; ++j)
   {
-    free(CV->G_rho[j]); free(CV->G_u[j]); free(CV->G_v[j]); free(CV->G_e[j]);
-    free(CV->rhoIy[j]); free(CV->uIy[j]); free(CV->vIy[j]); free(CV->pIy[j]);
-    free(CV->s_rho[j]); free(CV->s_u[j]); free(CV->s_v[j]); free(CV->s_p[j]);
-    free(CV->t_rho[j]); free(CV->t_u[j]); free(CV->t_v[j]); free(CV->t_p[j]);
+    FREE(CV->G_rho[j]); FREE(CV->G_u[j]); FREE(CV->G_v[j]); FREE(CV->G_e[j]);
+    FREE(CV->rhoIy[j]); FREE(CV->uIy[j]); FREE(CV->vIy[j]); FREE(CV->pIy[j]);
 
     CV->G_rho[j]= NULL; CV->G_u[j]= NULL; CV->G_v[j]= NULL; CV->G_e[j]= NULL; 
     CV->rhoIy[j]= NULL; CV->uIy[j]= NULL; CV->vIy[j]= NULL; CV->pIy[j]= NULL; 
-    CV->s_rho[j]= NULL; CV->s_u[j]= NULL; CV->s_v[j]= NULL; CV->s_p[j]= NULL; 
-    CV->t_rho[j]= NULL; CV->t_u[j]= NULL; CV->t_v[j]= NULL; CV->t_p[j]= NULL; 
   }
-    free(CV->F_rho); free(CV->F_u); free(CV->F_v); free(CV->F_e);
-    free(CV->rhoIx); free(CV->uIx); free(CV->vIx); free(CV->pIx);
-    free(CV->G_rho); free(CV->G_u); free(CV->G_v); free(CV->G_e);
-    free(CV->rhoIy); free(CV->uIy); free(CV->vIy); free(CV->pIy); 
-    free(CV->s_rho); free(CV->s_u); free(CV->s_v); free(CV->s_p);
-    free(CV->t_rho); free(CV->t_u); free(CV->t_v); free(CV->t_p);
+    FREE(CV->F_rho); FREE(CV->F_u); FREE(CV->F_v); FREE(CV->F_e);
+    FREE(CV->rhoIx); FREE(CV->uIx); FREE(CV->vIx); FREE(CV->pIx);
+    FREE(CV->G_rho); FREE(CV->G_u); FREE(CV->G_v); FREE(CV->G_e);
+    FREE(CV->rhoIy); FREE(CV->uIy); FREE(CV->vIy); FREE(CV->pIy); 
+    ghost_mem_free_2D(CV->s_rho, N_GHOST); ghost_mem_free_2D(CV->s_u, N_GHOST); ghost_mem_free_2D(CV->s_v, N_GHOST); ghost_mem_free_2D(CV->s_p, N_GHOST);
+    ghost_mem_free_2D(CV->t_rho, N_GHOST); ghost_mem_free_2D(CV->t_u, N_GHOST); ghost_mem_free_2D(CV->t_v, N_GHOST); ghost_mem_free_2D(CV->t_p, N_GHOST);
     free(bfv_L); free(bfv_R);
     free(bfv_D); free(bfv_U);
+    FREE(W_old); FREE(trouble);
     
     CV->F_rho= NULL; CV->F_u= NULL; CV->F_v= NULL; CV->F_e= NULL;
     CV->rhoIx= NULL; CV->uIx= NULL; CV->vIx= NULL; CV->pIx= NULL;
@@ -1,6 +1,8 @@
 /**
  * @file  grp_solver_radial_LAG_source.c
  * @brief This is a Lagrangian GRP scheme to solve radial(cylindrically) symmetric compressible fluid flows.
+ * @details With OpenMP the loops over grid cells and interfaces are shared among threads
+ *          when there are at least 'config[48]' grid cells.
  */
 
 #include <stdio.h>
@@ -9,6 +11,9 @@
 #include <stdlib.h>
 #include <time.h>
 #include <stdbool.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "../include_cii/mem.h"
 #include "../include/var_struc.h"
@@ -42,7 +47,7 @@ void GRP_solver_radial_LAG_source(struct cell_var_stru CV, struct radial_mesh_va
 {
     int i, k=0;
 
-    clock_t tic, toc;
+    double tic, toc;
     double cpu_time_sum = 0.0;
 
     //parameters
@@ -54,6 +59,11 @@ void GRP_solver_radial_LAG_source(struct cell_var_stru CV, struct radial_mesh_va
     int    const Ncell   = (int)config[3];  // Number of computing cells in r direction
     int    const Md      = Ncell+2;         // max vector dimension
     double       dt      = config[16];      // the length of the time step
+#ifdef _OPENMP
+    _Bool  const par     = Ncell >= (int)config[48]; // whether the loops are shared among threads
+    if (par)
+	printf("@@ Number of threads for OpenMP: %d\n", omp_get_max_threads());
+#endif
 
     double U_T,V_T;
     double Rb_NStep,Lb_NStep;
@@ -62,6 +72,7 @@ void GRP_solver_radial_LAG_source(struct cell_var_stru CV, struct radial_mesh_va
     double wave_speed[2], dire[4], mid[4];
 
     double Smax_dr;
+    _Bool ifv_err; // miscalculation indicator of the interfacial variables
     double time_c = 0.0;
     _Bool stop_t = false;
     int nt = 0, nt_plot = 0;
@@ -125,7 +136,11 @@ void GRP_solver_radial_LAG_source(struct cell_var_stru CV, struct radial_mesh_va
 
     for(k = 1; k <= N; k++)
 	{
-	    tic = clock();
+#ifdef _OPENMP
+	    tic = omp_get_wtime();
+#else
+	    tic = (double)clock() / (double)CLOCKS_PER_SEC;
+#endif
 
 	    if (time_c >= time_plot[nt_plot] && nt_plot < (*N_plot-1))
 		{
@@ -177,6 +192,11 @@ void GRP_solver_radial_LAG_source(struct cell_var_stru CV, struct radial_mesh_va
 	    DmD[Ncell+1] = 0.0;
 	    DmP[Ncell+1] = 0.0;
 
+	    ifv_err = false;
+#ifdef _OPENMP
+#pragma omp parallel for firstprivate(ifv_L, ifv_R) private(wave_speed, dire, mid) \
+reduction(max:Smax_dr) reduction(||:stop_t, ifv_err) if(par) schedule(dynamic, 64)
+#endif
 	    for(i = 0; i <= Ncell; i++)
 		{
 		    ifv_L.gamma = GammaGamma[i];
@@ -196,7 +216,8 @@ void GRP_solver_radial_LAG_source(struct cell_var_stru CV, struct radial_mesh_va
 		    if(ifvar_check(&ifv_L, &ifv_R, 1))
 			{
 			    printf(" on [%d, %d] (t_n, x).\n", k, i);
-			    goto return_NULL;
+			    ifv_err = true;
+			    continue;
 			}
 
 		    GRPsolverRLag(wave_speed, dire, mid, &ifv_L, &ifv_R, Rb[i+1], M, eps, eps);
@@ -219,6 +240,8 @@ void GRP_solver_radial_LAG_source(struct cell_var_stru CV, struct radial_mesh_va
 		    DL_t[i+1]  = dire[0];
 		    DR_t[i+1]  = dire[3];
 		}
+	    if(ifv_err)
+		goto return_NULL;
 
 	    if(isfinite(Timeout) || !isfinite(config[16]) || config[16] <= 0.0) //compute for time step
 		{
@@ -237,11 +260,16 @@ void GRP_solver_radial_LAG_source(struct cell_var_stru CV, struct radial_mesh_va
 			}
 		}
 
+	    // the side midpoints of a grid cell are reconstructed by the slopes of the same grid cell
+#ifdef _OPENMP
+#pragma omp parallel for firstprivate(ifv_L) private(ifv_R, U_T, V_T, dire, mid) if(par) schedule(dynamic, 64)
+#endif
 	    for(i = 1; i <= Ncell; i++)
 		{
 		    ifv_L.gamma = GammaGamma[i];
-		    ifv_L.RHO   = DD[i]+(0.5*(Rb[i]+Rb[i+1])-RR[i])*ifv_L.d_rho;
-		    ifv_L.P     = PP[i]+(0.5*(Rb[i]+Rb[i+1])-RR[i])*ifv_L.d_p;
+		    ifv_L.d_rho = DmD[i];
+		    ifv_L.RHO   = DD[i]+(0.5*(Rb[i]+Rb[i+1])-RR[i])*DmD[i];
+		    ifv_L.P     = PP[i]+(0.5*(Rb[i]+Rb[i+1])-RR[i])*DmP[i];
 		    U_T         = UU[i]+(0.5*(Rb[i]+Rb[i+1])-RR[i])*DmU[i];
 		    V_T         = 0.5*(Rb[i]+Rb[i+1])*tan(0.5*dtheta)*TmV[i];
 		    ifv_L.U     = -U_T*sin(0.5*dtheta)+V_T*cos(0.5*dtheta);
@@ -255,6 +283,9 @@ void GRP_solver_radial_LAG_source(struct cell_var_stru CV, struct radial_mesh_va
 		    VLmin[i] = (ifv_L.U*cos(0.5*dtheta)+ifv_L.V*sin(0.5*dtheta)+dt*dire[1])*sin(0.5*dtheta);
 		}
 
+#ifdef _OPENMP
+#pragma omp parallel for private(Rb_NStep, Lb_NStep) if(par)
+#endif
 	    for(i = 0; i <= Ncell; i++)
 		{
 		    Umin[i+1] += 0.5 * dt * U_t[i+1];
@@ -269,7 +300,6 @@ void GRP_solver_radial_LAG_source(struct cell_var_stru CV, struct radial_mesh_va
 		    Rbh[i+1] = (Rb[i+1]*(2.*Lb[i+1]+Lb_NStep)+Rb_NStep*(Lb[i+1]+2.*Lb_NStep))/(3.*(Lb[i+1]+Lb_NStep));
 		    Rb[i+1]  = Rb_NStep;
 		    Lb[i+1]  = Lb_NStep;
-		    RR[i]    = Rb[i+1]-(2.*Lb[i]+Lb[i+1])/(3.*(Lb[i]+Lb[i+1]))*(Rb[i+1]-Rb[i]);
 		    /*
 		      Rb_side[i] =0.25*(Lb[i]+Lb[i+1])  /sin(0.5*dtheta);
 		      Lb_side[i] =0.5 *(Lb[i+1]-Lb[i])  /sin(0.5*dtheta);
@@ -283,18 +313,30 @@ void GRP_solver_radial_LAG_source(struct cell_var_stru CV, struct radial_mesh_va
 		    DLmin[i+1] += dt * DL_t[i+1];
 		    DRmin[i+1] += dt * DR_t[i+1];
 		}
+	    // the centroids need both moved boundaries of a grid cell
+#ifdef _OPENMP
+#pragma omp parallel for if(par)
+#endif
+	    for(i = 0; i <= Ncell; i++)
+		RR[i] = Rb[i+1]-(2.*Lb[i]+Lb[i+1])/(3.*(Lb[i]+Lb[i+1]))*(Rb[i+1]-Rb[i]);
 
 	    radial_mesh_update(rmv);
 
 	    DD[0] = mass[0]/vol[0];
 	    UU[0] = 0.0;
 	    EE[0] = EE[0] - dt/mass[0]*(F_e[1]*Rbh[1]*Lbh[1]);
+#ifdef _OPENMP
+#pragma omp parallel for if(par)
+#endif
 	    for(i = 1; i <= Ncell; i++) //m=2
 		{
 		    DD[i] = mass[i]/vol[i];
 		    UU[i] = UU[i] - dt/mass[i]*((F_u[i+1]-F_u2[i])*Rbh[i+1]*Lbh[i+1]-(F_u[i]-F_u2[i])*Rbh[i]*Lbh[i]);
 		    EE[i] = EE[i] - dt/mass[i]*( F_e[i+1]         *Rbh[i+1]*Lbh[i+1]- F_e[i]         *Rbh[i]*Lbh[i]);
 		}
+#ifdef _OPENMP
+#pragma omp parallel for reduction(||:stop_t) if(par)
+#endif
 	    for(i = 0; i <= Ncell; i++) //m=2
 		{
 		    PP[i] = (EE[i] - 0.5*UU[i]*UU[i]) * (GammaGamma[i]-1.0) * DD[i];
@@ -305,6 +347,9 @@ void GRP_solver_radial_LAG_source(struct cell_var_stru CV, struct radial_mesh_va
 			}
 		}
 
+#ifdef _OPENMP
+#pragma omp parallel for if(par)
+#endif
 	    for(i = 1; i <= Ncell; i++)
 		{
 		    DmU[i]=(Umin[i+1] -Umin[i]) /Ddr[i];
@@ -326,8 +371,12 @@ void GRP_solver_radial_LAG_source(struct cell_var_stru CV, struct radial_mesh_va
 	    if(stop_t || time_c > (Timeout - eps) || !isfinite(time_c))
 		break;
 
-	    toc = clock();
-	    cpu_time_sum += ((double)toc - (double)tic) / (double)CLOCKS_PER_SEC;
+#ifdef _OPENMP
+	    toc = omp_get_wtime();
+#else
+	    toc = (double)clock() / (double)CLOCKS_PER_SEC;
+#endif
+	    cpu_time_sum += toc - tic;
 	    cpu_time[nt]  = cpu_time_sum;
 	}
 
@@ -362,7 +411,10 @@ void GRP_solver_radial_LAG_source(struct cell_var_stru CV, struct radial_mesh_va
     FREE(P_t);
     FREE(DL_t);
     FREE(DR_t);
-    free(F_u);
-    free(F_e);
+    FREE(Rbh);
+    FREE(Lbh);
+    FREE(F_u);
+    FREE(F_u2);
+    FREE(F_e);
     FREE(mass);
 }
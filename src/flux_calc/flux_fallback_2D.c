@@ -0,0 +1,193 @@
+/**
+ * @file flux_fallback_2D.c
+ * @brief This file is a function which recomputes first-order fluxes of 2-D Euler equations
+ *        around troubled grid cells and re-updates them (a posteriori MOOD limiting).
+ */
+#include <stdio.h>
+#include <math.h>
+
+#include "../include/var_struc.h"
+#include "../include/riemann_solver.h"
+#include "../include/flux_calc.h"
+
+
+#define TROUBLED 1 //!< Troubled grid cell whose interfacial fluxes are recomputed in first order.
+#define NEIGHBOR 2 //!< Grid cell re-updated because one of its interfacial fluxes is recomputed.
+#define N_ITER   3 //!< Maximum number of fallback iterations.
+
+/**
+ * @brief This function fills the primitive variables of a grid cell saved before the update.
+ * @param[out] ifv:   Structure pointer of interfacial fluid variables.
+ * @param[in]  W_old: Array of the primitive variables (RHO, U, V, P) saved before the update.
+ * @param[in]  idx:   Serial number of the grid cell, j*n+i.
+ */
+static inline void ifv_fill_old(struct i_f_var * ifv, const double * W_old, const int idx)
+{
+    ifv->RHO = W_old[4*idx];
+    ifv->U   = W_old[4*idx+1];
+    ifv->V   = W_old[4*idx+2];
+    ifv->P   = W_old[4*idx+3];
+}
+
+/**
+ * @brief This function fills the primitive variables on the ghost grid cell at boundary.
+ * @details The ghost grid cells are not touched by the update, so they still hold the states at t_{n}.
+ * @param[out] ifv: Structure pointer of interfacial fluid variables.
+ * @param[in]  CV:  Structure of cell variable data at the current plot time step.
+ * @param[in]  j:   x-index of the ghost grid cell.
+ * @param[in]  i:   y-index of the ghost grid cell.
+ */
+static inline void ifv_fill_ghost(struct i_f_var * ifv, const struct cell_var_stru * CV, const int j, const int i)
+{
+    ifv->RHO = CV->RHO[j][i];
+    ifv->U   = CV->U[j][i];
+    ifv->V   = CV->V[j][i];
+    ifv->P   = CV->P[j][i];
+}
+
+/**
+ * @brief This function recomputes the x-interfacial flux F at x_{j-1/2} by HLL solver.
+ */
+static void flux_HLL_x(const int m, const int n, const int nt, const int j, const int i, struct cell_var_stru * CV, const double * W_old)
+{
+    struct i_f_var ifv_L = {.n_x = 1.0, .n_y = 0.0, .gamma = config[6]};
+    struct i_f_var ifv_R = ifv_L;
+    double F[4], lambda_max;
+
+    if(j)
+	ifv_fill_old(&ifv_L, W_old, (j-1)*n+i);
+    else
+	ifv_fill_ghost(&ifv_L, CV+nt, -1, i);
+    if(j < m)
+	ifv_fill_old(&ifv_R, W_old, j*n+i);
+    else
+	ifv_fill_ghost(&ifv_R, CV+nt, m, i);
+    HLL_2D_solver(F, &lambda_max, &ifv_L, &ifv_R);
+    CV->F_rho[j][i] = F[0];
+    CV->F_u[j][i]   = F[1];
+    CV->F_v[j][i]   = F[2];
+    CV->F_e[j][i]   = F[3];
+}
+
+/**
+ * @brief This function recomputes the y-interfacial flux G at y_{i-1/2} by HLL solver.
+ */
+static void flux_HLL_y(const int m, const int n, const int nt, const int j, const int i, struct cell_var_stru * CV, const double * W_old)
+{
+    struct i_f_var ifv_L = {.n_x = 0.0, .n_y = 1.0, .gamma = config[6]};
+    struct i_f_var ifv_R = ifv_L;
+    double F[4], lambda_max;
+
+    if(i)
+	ifv_fill_old(&ifv_L, W_old, j*n+i-1);
+    else
+	ifv_fill_ghost(&ifv_L, CV+nt, j, -1);
+    if(i < n)
+	ifv_fill_old(&ifv_R, W_old, j*n+i);
+    else
+	ifv_fill_ghost(&ifv_R, CV+nt, j, n);
+    HLL_2D_solver(F, &lambda_max, &ifv_L, &ifv_R);
+    CV->G_rho[j][i] = F[0];
+    CV->G_u[j][i]   = F[1];
+    CV->G_v[j][i]   = F[2];
+    CV->G_e[j][i]   = F[3];
+}
+
+/**
+ * @brief This function replaces the high-order fluxes around troubled grid cells by first-order HLL fluxes
+ *        computed from the states at t_{n}, and re-updates only the grid cells touching a replaced flux.
+ * @details The update is redone from the saved states, so it stays conservative. Grid cells that still fail
+ *          the positivity check are marked troubled and the fallback is repeated at most N_ITER times.
+ *          The slopes of the troubled grid cells are set to zero.
+ * @param[in] m:      Number of the x-grids: n_x.
+ * @param[in] n:      Number of the y-grids: n_y.
+ * @param[in] nt:     Current plot time step for computing updates of conservative variables.
+ * @param[in] nu:     tau/h_x of the update, 0.0 if there is no x-flux in the update.
+ * @param[in] mu:     tau/h_y of the update, 0.0 if there is no y-flux in the update.
+ * @param[in,out] CV: Structure of cell variable data, the ghost grid cells of CV[nt] hold the boundary states at t_{n}.
+ * @param[in] W_old:  Array of the primitive variables (RHO, U, V, P) of grid cell j*n+i saved before the update.
+ * @param[in,out] trouble: Array of troubled grid cell indicators, nonzero entries are troubled on input.
+ * @return    Number of grid cells still troubled after the fallback.
+ */
+int flux_fallback_2D(const int m, const int n, const int nt, const double nu, const double mu, struct cell_var_stru * CV,
+		     const double * W_old, char * trouble)
+{
+    double const eps   = config[4];
+    double const gamma = config[6];
+    int i, j, idx, it, n_bad = 0, n_new;
+    double rho, mom_x, mom_y, ene;
+
+    for(it = 0; it < N_ITER; ++it)
+	{
+	    // first-order fluxes on all interfaces of the troubled grid cells
+	    for(j = 0; j < m; ++j)
+		for(i = 0; i < n; ++i)
+		    if(trouble[j*n+i] == TROUBLED)
+			{
+			    if(nu > 0.0)
+				{
+				    flux_HLL_x(m, n, nt, j,   i, CV, W_old);
+				    flux_HLL_x(m, n, nt, j+1, i, CV, W_old);
+				    if(j > 0   && !trouble[(j-1)*n+i])
+					trouble[(j-1)*n+i] = NEIGHBOR;
+				    if(j < m-1 && !trouble[(j+1)*n+i])
+					trouble[(j+1)*n+i] = NEIGHBOR;
+				    CV->s_rho[j][i] = CV->s_u[j][i] = CV->s_v[j][i] = CV->s_p[j][i] = 0.0;
+				}
+			    if(mu > 0.0)
+				{
+				    flux_HLL_y(m, n, nt, j, i,   CV, W_old);
+				    flux_HLL_y(m, n, nt, j, i+1, CV, W_old);
+				    if(i > 0   && !trouble[j*n+i-1])
+					trouble[j*n+i-1] = NEIGHBOR;
+				    if(i < n-1 && !trouble[j*n+i+1])
+					trouble[j*n+i+1] = NEIGHBOR;
+				    CV->t_rho[j][i] = CV->t_u[j][i] = CV->t_v[j][i] = CV->t_p[j][i] = 0.0;
+				}
+			}
+	    // re-update of the grid cells touching a replaced flux from the states at t_{n}
+	    n_bad = n_new = 0;
+	    for(j = 0; j < m; ++j)
+		for(i = 0; i < n; ++i)
+		    {
+			idx = j*n+i;
+			if(!trouble[idx])
+			    continue;
+			rho   = W_old[4*idx];
+			mom_x = rho*W_old[4*idx+1];
+			mom_y = rho*W_old[4*idx+2];
+			ene   = W_old[4*idx+3]/(gamma-1.0) + 0.5*(mom_x*W_old[4*idx+1] + mom_y*W_old[4*idx+2]);
+			if(nu > 0.0)
+			    {
+				rho   -= nu*(CV->F_rho[j+1][i]-CV->F_rho[j][i]);
+				mom_x -= nu*(CV->F_u[j+1][i]  -CV->F_u[j][i]);
+				mom_y -= nu*(CV->F_v[j+1][i]  -CV->F_v[j][i]);
+				ene   -= nu*(CV->F_e[j+1][i]  -CV->F_e[j][i]);
+			    }
+			if(mu > 0.0)
+			    {
+				rho   -= mu*(CV->G_rho[j][i+1]-CV->G_rho[j][i]);
+				mom_x -= mu*(CV->G_u[j][i+1]  -CV->G_u[j][i]);
+				mom_y -= mu*(CV->G_v[j][i+1]  -CV->G_v[j][i]);
+				ene   -= mu*(CV->G_e[j][i+1]  -CV->G_e[j][i]);
+			    }
+			CV[nt].RHO[j][i] = rho;
+			CV[nt].U[j][i]   = mom_x / rho;
+			CV[nt].V[j][i]   = mom_y / rho;
+			CV[nt].E[j][i]   = ene   / rho;
+			CV[nt].P[j][i]   = (ene - 0.5*mom_x*CV[nt].U[j][i] - 0.5*mom_y*CV[nt].V[j][i])*(gamma-1.0);
+			if(!(CV[nt].P[j][i] >= eps && rho >= eps && isfinite(CV[nt].P[j][i])))
+			    {
+				// a neighbor broken by the replaced flux gets its own first-order fluxes next iteration
+				n_new += trouble[idx] == NEIGHBOR;
+				trouble[idx] = TROUBLED;
+				n_bad++;
+			    }
+		    }
+	    if(!n_new)
+		break;
+	}
+    if(n_bad)
+	printf("<0.0 error on %d cells after first-order fallback - MOOD\n", n_bad);
+    return n_bad;
+}
@@ -5,6 +5,7 @@
  */
 #include <stdio.h>
 #include <math.h>
+#include <stdbool.h>
 
 #include "../include/var_struc.h"
 #include "../include/inter_process.h"
@@ -235,3 +236,82 @@ int GRP_2D_flux(struct i_f_var * ifv, struct i_f_var * ifv_R, const double tau)
 #endif
 	return retval;
 }
+
+
+/**
+ * @brief This function checks whether a cell interface lies in a quiescent region.
+ * @details The interface is quiescent if the states on both sides agree within eps and,
+ *          for second-order schemes, all slopes vanish within eps, i.e. the whole neighbourhood is uniform.
+ *          Waves arriving at the neighbourhood make the slopes nonzero and re-activate the interface.
+ * @param[in] ifv:   Structure pointer of interfacial left state.
+ * @param[in] ifv_R: Structure pointer of interfacial right state.
+ * @param[in] Slope: Are there slopes? (true: 2nd-order / false: 1st-order)
+ * @return Whether the interface is quiescent.
+ */
+_Bool quiescent_check(const struct i_f_var * ifv, const struct i_f_var * ifv_R, const _Bool Slope)
+{
+	const double eps = config[4];
+
+	if (!(fabs(ifv->RHO - ifv_R->RHO) < eps && fabs(ifv->P - ifv_R->P) < eps &&
+	      fabs(ifv->U   - ifv_R->U)   < eps && fabs(ifv->V - ifv_R->V) < eps))
+		return false;
+#ifdef MULTIFLUID_BASICS
+	if (!(fabs(ifv->PHI - ifv_R->PHI) < eps && fabs(ifv->Z_a - ifv_R->Z_a) < eps && ifv->gamma == ifv_R->gamma))
+		return false;
+#endif
+	if (!Slope)
+		return true;
+	if (!(fabs(ifv->d_rho) < eps && fabs(ifv->d_u) < eps && fabs(ifv->d_v) < eps && fabs(ifv->d_p) < eps &&
+	      fabs(ifv->t_rho) < eps && fabs(ifv->t_u) < eps && fabs(ifv->t_v) < eps && fabs(ifv->t_p) < eps))
+		return false;
+	if (!(fabs(ifv_R->d_rho) < eps && fabs(ifv_R->d_u) < eps && fabs(ifv_R->d_v) < eps && fabs(ifv_R->d_p) < eps &&
+	      fabs(ifv_R->t_rho) < eps && fabs(ifv_R->t_u) < eps && fabs(ifv_R->t_v) < eps && fabs(ifv_R->t_p) < eps))
+		return false;
+#ifdef MULTIFLUID_BASICS
+	if (!(fabs(ifv->d_phi)   < eps && fabs(ifv->d_z_a)   < eps && fabs(ifv->t_phi)   < eps && fabs(ifv->t_z_a)   < eps &&
+	      fabs(ifv_R->d_phi) < eps && fabs(ifv_R->d_z_a) < eps && fabs(ifv_R->t_phi) < eps && fabs(ifv_R->t_z_a) < eps))
+		return false;
+#endif
+	return true;
+}
+
+
+/**
+ * @brief This function calculate Eulerian fluxes of 2-D Euler equations on a quiescent interface.
+ * @details The (generalized) Riemann problem of a uniform state is solved exactly by the state itself,
+ *          so the fluxes are evaluated from the left state without calling any Riemann solver.
+ * @param[in,out] ifv: Structure pointer of interfacial evaluated variables and fluxes and left state.
+ */
+void uniform_2D_flux(struct i_f_var * ifv)
+{
+	const double n_x = ifv->n_x, n_y = ifv->n_y;
+	const double rho = ifv->RHO, p = ifv->P, u = ifv->U, v = ifv->V;
+	const double gamma = ifv->gamma;
+	ifv->lambda_u = 0.0;  ifv->lambda_v = 0.0;
+
+	ifv->F_rho = rho*(u*n_x + v*n_y);
+	ifv->F_u   = ifv->F_rho*u + p*n_x;
+	ifv->F_v   = ifv->F_rho*v + p*n_y;
+	ifv->F_e   = (gamma/(gamma-1.0))*p/rho + 0.5*(u*u + v*v);
+	ifv->F_e   = ifv->F_rho*ifv->F_e;
+
+	ifv->U_int   = u;
+	ifv->V_int   = v;
+	ifv->RHO_int = rho;
+	ifv->P_int   = p;
+
+#ifdef MULTIFLUID_BASICS
+	const double phi = ifv->PHI, z_a = ifv->Z_a;
+	ifv->F_phi = ifv->F_rho*phi;
+	if ((_Bool)config[60])
+		ifv->F_gamma = ifv->F_rho*gamma;
+	ifv->F_e_a = z_a/(config[6]-1.0)*p/rho + 0.5*phi*(u*u + v*v);
+	ifv->F_e_a = ifv->F_rho*ifv->F_e_a;
+
+	ifv->U_qt_add_c = ifv->F_rho*u*phi;
+	ifv->V_qt_add_c = ifv->F_rho*v*phi;
+	ifv->U_qt_star  = p*n_x;
+	ifv->V_qt_star  = p*n_y;
+	ifv->P_star     = p/rho*ifv->F_rho;
+#endif
+}
@@ -58,7 +58,7 @@
  *                          e.g. 'hydrocode.out GRP_Book/6_1 GRP_Book/6_1 2[_GRP] LAG 5=100' (second-order Lagrangian GRP scheme).
  *                          - order: Order of numerical scheme (= 1 or 2).
  *                          - scheme: Scheme name (= Riemann_exact/Godunov, GRP or …).
- *                          - coordinate: Lagrangian/Eulerian coordinate framework (= LAG or EUL).
+ *                          - coordinate: Lagrangian/Eulerian/ALE coordinate framework (= LAG, EUL or ALE).
  *            - Windows: Run 'hydrocode.bat' command on the terminal. \n
  *                       The details are as follows: \n
  *                       Run 'hydrocode.exe name_of_test_example name_of_numeric_result order[_scheme] 
@@ -90,6 +90,7 @@
 #include <string.h>
 #include <math.h>
 
+#include "../include_cii/mem.h"
 #include "../include/var_struc.h"
 #include "../include/file_io.h"
 #include "../include/finite_volume.h"
@@ -115,24 +116,10 @@ double config[N_CONF]; //!< Initial configuration data array.
  */
 #define CV_INIT_MEM(v, N)						\
     do {								\
-	CV.v = (double **)malloc(N * sizeof(double *));			\
-	if(CV.v == NULL)						\
-	    {								\
-		printf("NOT enough memory! %s\n", #v);			\
-		retval = 5;						\
-		goto return_NULL;					\
-	    }								\
+	CV.v = (double **)ALLOC_TAG(N * sizeof(double *), "fields");	\
 	CV.v[0] = FV0.v;						\
 	for(k = 1; k < N; ++k)						\
-	    {								\
-		CV.v[k] = (double *)malloc(m * sizeof(double));		\
-		if(CV.v[k] == NULL)					\
-		    {							\
-			printf("NOT enough memory! %s[%d]\n", #v, k);	\
-			retval = 5;					\
-			goto return_NULL;				\
-		    }							\
-	    }								\
+	    CV.v[k] = (double *)ALLOC_TAG(m * sizeof(double), "fields"); \
     } while (0)
 
 /**
@@ -143,7 +130,7 @@ double config[N_CONF]; //!< Initial configuration data array.
  *          - argv[1]: Folder name of test example (input path).
  *          - argv[2]: Folder name of numerical results (output path).
  *          - argv[3]: Order of numerical scheme[_scheme name] (= 1[_Riemann_exact] or 2[_GRP]).
- *          - argv[4]: Lagrangian/Eulerian coordinate framework (= LAG or EUL).
+ *          - argv[4]: Lagrangian/Eulerian/ALE coordinate framework (= LAG, EUL or ALE).
  *          - argv[5,6,…]: Configuration supplement config[n]=(double)C (= n=C).
  * @return Program exit status code.
  */
@@ -155,7 +142,7 @@ int main(int argc, char *argv[])
       config[k] = INFINITY;
 
   char * scheme = NULL; // Riemann_exact(Godunov), GRP
-  arg_preprocess(4, argc, argv, scheme);
+  arg_preprocess(4, argc, argv, &scheme);
 
   // Set dimension.
   config[0] = (double)1; // Dimensionality = 1
@@ -211,23 +198,9 @@ int main(int argc, char *argv[])
   CV_INIT_MEM(RHO, N);
   CV_INIT_MEM(U, N);
   CV_INIT_MEM(P, N);
-  CV.E = (double **)malloc(N * sizeof(double *));
-  if(CV.E == NULL)
-      {
-	  printf("NOT enough memory! E\n");
-	  retval = 5;
-	  goto return_NULL;
-      }
+  CV.E = (double **)ALLOC_TAG(N * sizeof(double *), "fields");
   for(k = 0; k < N; ++k)
-  {
-    CV.E[k] = (double *)malloc(m * sizeof(double));
-    if(CV.E[k] == NULL)
-    {
-      printf("NOT enough memory! E[%d]\n", k);
-      retval = 5;
-      goto return_NULL;
-    }
-  }
+    CV.E[k] = (double *)ALLOC_TAG(m * sizeof(double), "fields");
   // Initialize the values of energy in computational cells and x-coordinate of the cell interfaces.
   for(j = 0; j <= m; ++j)
       X[0][j] = h * j;
@@ -235,41 +208,15 @@ int main(int argc, char *argv[])
       CV.E[0][j] = 0.5*CV.U[0][j]*CV.U[0][j] + CV.P[0][j]/(gamma - 1.0)/CV.RHO[0][j];
 
   if (strcmp(argv[4],"LAG") == 0) // Use GRP/Godunov scheme to solve it on Lagrangian coordinate.
-      {
-	  config[8] = (double)1;
-	  switch(order)
-	      {
-	      case 1:
-		  Godunov_solver_LAG_source(m, CV, X, cpu_time, &N, time_plot);
-		  break;
-	      case 2:
-		  GRP_solver_LAG_source(m, CV, X, cpu_time, &N, time_plot);
-		  break;
-	      default:
-		  printf("NOT appropriate order of the scheme! The order is %d.\n", order);
-		  retval = 4;
-		  goto return_NULL;
- 	      }
-      }
+      config[8] = (double)1;
+  else if (strcmp(argv[4],"ALE") == 0) // Use GRP/Godunov scheme to solve it on ALE coordinate.
+      config[8] = (double)2;
   else if (strcmp(argv[4],"EUL") == 0) // Use GRP/Godunov scheme to solve it on Eulerian coordinate.
       {
 	  config[8] = (double)0;
 	  for (k = 1; k < N; ++k)
 	      for (j = 0; j <= m; ++j)
 		  X[k][j] = X[0][j];
-	  switch(order)
-	      {
-	      case 1:
-		  Godunov_solver_EUL_source(m, CV, cpu_time, &N, time_plot);
-		  break;
-	      case 2:
-		  GRP_solver_EUL_source(m, CV, cpu_time, &N, time_plot);
-		  break;
-	      default:
-		  printf("NOT appropriate order of the scheme! The order is %d.\n", order);
-		  retval = 4;
-		  goto return_NULL;
-	      }
       }
   else
       {
@@ -277,6 +224,12 @@ int main(int argc, char *argv[])
 	  retval = 4;
 	  goto return_NULL;
       }
+  if (!finite_volume_scheme_1D(m, CV, X, cpu_time, &N, time_plot))
+      {
+	  printf("NOT appropriate order of the scheme! The order is %d.\n", order);
+	  retval = 4;
+	  goto return_NULL;
+      }
 
   // Write the final data down.
 #ifndef NODATPLOT
@@ -295,30 +248,21 @@ int main(int argc, char *argv[])
   FV0.P   = NULL;
   for(k = 1; k < N; ++k)
   {
-    free(CV.E[k]);
-    free(CV.RHO[k]);
-    free(CV.U[k]);
-    free(CV.P[k]);
+    FREE(CV.E[k]);
+    FREE(CV.RHO[k]);
+    FREE(CV.U[k]);
+    FREE(CV.P[k]);
     free(X[k]);
-    CV.E[k]   = NULL;
-    CV.RHO[k] = NULL;
-    CV.U[k]   = NULL;
-    CV.P[k]   = NULL;
     X[k] = NULL;
   }
-  free(CV.E[0]);
-  CV.E[0]   = NULL;
+  FREE(CV.E[0]);
   CV.RHO[0] = NULL;
   CV.U[0]   = NULL;
   CV.P[0]   = NULL;
-  free(CV.E);
-  free(CV.RHO);
-  free(CV.U);
-  free(CV.P);
-  CV.E   = NULL;
-  CV.RHO = NULL;
-  CV.U   = NULL;
-  CV.P   = NULL;
+  FREE(CV.E);
+  FREE(CV.RHO);
+  FREE(CV.U);
+  FREE(CV.P);
   free(X);
   X = NULL;
   free(cpu_time);
@@ -85,6 +85,8 @@
  *          - NODATPLOT: in hydrocode.c. (Default: undef)
  *          - NOTECPLOT: in hydrocode.c. (Default: undef)
  *          - HDF5PLOT:  in hydrocode.c. (Default: undef)
+ *          - TIMELINE:  in timeline.c, write the per-thread timeline of the solver phases into 'timeline.json'. (Default: undef)
+ *          - ROOFLINE:  in roofline.c, print the bytes, flops and time of the solver phases at exit. (Default: undef)
  *          - EXACT_TANGENT_DERIVATIVE: in linear_GRP_solver_Edir_G2D.c.   (Default: undef)
  *          - Riemann_solver_exact_single: in riemann_solver.h.            (Default: Riemann_solver_exact_Ben)
  *          - MULTIFLUID_BASICS: 'Switch whether to compute multi-fluids.' (Default: undef)
@@ -99,6 +101,7 @@
 
 #include "../include/var_struc.h"
 #include "../include/file_io.h"
+#include "../include/tools.h"
 #include "../include/finite_volume.h"
 
 
@@ -128,25 +131,7 @@ double config[N_CONF]; //!< Initial configuration data array.
 #define CV_INIT_MEM(v, N)						\
     do {								\
     for(k = 0; k < N; ++k)						\
-	{								\
-	    CV[k].v = (double **)malloc(n_x * sizeof(double *));	\
-	    if(CV[k].v == NULL)						\
-		{							\
-		    printf("NOT enough memory! CV[%d].%s\n", k, #v);	\
-		    retval = 5;						\
-		    goto return_NULL;					\
-		}							\
-	    for(j = 0; j < n_x; ++j)					\
-		{							\
-		    CV[k].v[j] = (double *)malloc(n_y * sizeof(double)); \
-		    if(CV[k].v[j] == NULL)				\
-			{						\
-			    printf("NOT enough memory! CV[%d].%s[%d]\n", k, #v, j); \
-			    retval = 5;					\
-			    goto return_NULL;				\
-			}						\
-		}							\
-	}								\
+	CV[k].v = ghost_mem_2D(n_x, n_y, N_GHOST);			\
     } while (0)
 
 /**
@@ -168,7 +153,7 @@ int main(int argc, char *argv[])
   for(k = 1; k < N_CONF; k++)
       config[k] = INFINITY;
   char * scheme = NULL; // Riemann_exact(Godunov), GRP
-  arg_preprocess(4, argc, argv, scheme);
+  arg_preprocess(4, argc, argv, &scheme);
 
   // Set dimension.
   config[0] = (double)2; // Dimensionality = 2
@@ -183,6 +168,7 @@ int main(int argc, char *argv[])
      * The (n_x*n_y) array elements of these variables are the initial value.
      */
   struct flu_var FV0 = initialize_2D(argv[1], &N, &N_plot, &time_plot); // Structure of initial data array pointer.
+  insitu_init(argv[1]);
     /* 
      * (n_x*n_y) is the number of initial value as well as the number of grids.
      * As (n_x*n_y) is frequently use to represent the number of grids,
@@ -195,7 +181,7 @@ int main(int argc, char *argv[])
   const _Bool dim_split = (_Bool)config[33]; // Dimensional splitting?
 
   // Structure of fluid variables in computational cells array pointer.
-  struct cell_var_stru * CV = (struct cell_var_stru*)malloc(N * sizeof(struct cell_var_stru));
+  struct cell_var_stru * CV = (struct cell_var_stru*)calloc(N, sizeof(struct cell_var_stru));
   double ** X, ** Y;
   double * cpu_time = (double *)malloc(N * sizeof(double));
   X = (double **)malloc((n_x+1) * sizeof(double *));
@@ -280,6 +266,7 @@ int main(int argc, char *argv[])
       }
 
   // Write the final data down.
+  TL_BEGIN(tl_out);
 #ifndef NODATPLOT
   file_2D_write(n_x, n_y, N_plot, CV, X, Y, cpu_time, argv[2], time_plot);
 #endif
@@ -289,6 +276,7 @@ int main(int argc, char *argv[])
 #ifndef NOTECPLOT
   file_2D_write_POINT_TEC(n_x, n_y, 1, CV + N_plot-1, X, Y, cpu_time, argv[2], time_plot + N_plot-1);
 #endif
+  TL_END("output", tl_out);
 
  return_NULL:
   free(FV0.RHO);
@@ -301,24 +289,11 @@ int main(int argc, char *argv[])
   FV0.P   = NULL;
   for(k = 0; k < N; ++k)
   {
-    for(j = 0; j < n_x; ++j)
-	{
-            free(CV[k].RHO[j]);
-            free(CV[k].U[j]);
-            free(CV[k].V[j]);
-            free(CV[k].P[j]);
-            free(CV[k].E[j]);
-            CV[k].RHO[j] = NULL;
-            CV[k].U[j]   = NULL;
-            CV[k].V[j]   = NULL;
-            CV[k].P[j]   = NULL;
-            CV[k].E[j]   = NULL;
-	}
-    free(CV[k].RHO);
-    free(CV[k].U);
-    free(CV[k].V);
-    free(CV[k].P);
-    free(CV[k].E);
+    ghost_mem_free_2D(CV[k].RHO, N_GHOST);
+    ghost_mem_free_2D(CV[k].U,   N_GHOST);
+    ghost_mem_free_2D(CV[k].V,   N_GHOST);
+    ghost_mem_free_2D(CV[k].P,   N_GHOST);
+    ghost_mem_free_2D(CV[k].E,   N_GHOST);
     CV[k].RHO = NULL;
     CV[k].U   = NULL;
     CV[k].V   = NULL;
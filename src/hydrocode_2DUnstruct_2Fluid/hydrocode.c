@@ -90,6 +90,9 @@
  *          - NODATPLOT: in hydrocode.c. (Default: undef)
  *          - NOVTKPLOT: in hydrocode.c. (Default: undef)
  *          - NOTECPLOT: in hydrocode.c. (Default: undef)
+ *          - VTUZLIB:   in hydrocode.c. (Default: undef)
+ *          - TIMELINE:  in timeline.c, write the per-thread timeline of the solver phases into 'timeline.json'. (Default: undef)
+ *          - ROOFLINE:  in roofline.c, print the bytes, flops and time of the solver phases at exit. (Default: undef)
  *          - EXACT_TANGENT_DERIVATIVE: in linear_GRP_solver_Edir_G2D.c. (Default: undef)
  *          - Riemann_solver_exact_single: in riemann_solver.h.          (Default: Riemann_solver_exact_Ben)
  *          - MULTIFLUID_BASICS: in var_struc.h.                         (Default: def)
@@ -124,6 +127,11 @@
  * @brief Switch whether to plot without VTK data.
  */
 #define NOVTKPLOT
+/**
+ * @def VTUZLIB
+ * @brief Switch whether to compress VTU data with zlib (linking with '-lz').
+ */
+#define VTUZLIB
 #endif
 
 double config[N_CONF]; //!< Initial configuration data array.
@@ -147,7 +155,7 @@ int main(int argc, char *argv[])
   for(k = 1; k < N_CONF; k++)
       config[k] = INFINITY;
   char * scheme = NULL; // Riemann_exact(Godunov), GRP
-  arg_preprocess(4, argc, argv, scheme);
+  arg_preprocess(4, argc, argv, &scheme);
 
   // Set dimension.
   config[0] = (double)2; // Dimensionality = 2
@@ -162,6 +170,7 @@ int main(int argc, char *argv[])
      * The (num_cell) array elements of these variables are the initial value.
      */
   struct flu_var FV0 = initialize_2D(argv[1], &N, &N_plot, &time_plot);
+  insitu_init(argv[1]);
   struct mesh_var mv = mesh_init(argv[1], argv[4]);
 
   if ((_Bool)config[32])
@@ -170,7 +179,10 @@ int main(int argc, char *argv[])
 	  file_write_2D_BLOCK_TEC(FV0, mv, argv[2], 0.0);
 #endif
 #ifndef NOVTKPLOT
-	  file_write_3D_VTK(FV0, mv, argv[2], 0.0);
+	  if ((int)config[34])
+	      file_write_2D_VTU(FV0, mv, argv[2], 0.0);
+	  else
+	      file_write_3D_VTK(FV0, mv, argv[2], 0.0);
 #endif
       }
 
@@ -182,7 +194,11 @@ int main(int argc, char *argv[])
   file_write_2D_BLOCK_TEC(FV0, mv, argv[2], time_plot[N_plot-1]);
 #endif
 #ifndef NOVTKPLOT
-  file_write_3D_VTK(FV0, mv, argv[2], time_plot[N_plot-1]);
+  if ((int)config[34])
+      file_write_2D_VTU(FV0, mv, argv[2], time_plot[N_plot-1]);
+  else
+      file_write_3D_VTK(FV0, mv, argv[2], time_plot[N_plot-1]);
+  file_write_2D_VTU_free();
 #endif
 
   mesh_mem_free(&mv);
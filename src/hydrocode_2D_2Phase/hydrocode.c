@@ -136,7 +136,7 @@ int main(int argc, char *argv[])
   for(k = 1; k < N_CONF; k++)
       config[k] = INFINITY;
   char * scheme = NULL; // Riemann_exact(Godunov), GRP
-  arg_preprocess(4, argc, argv, scheme);
+  arg_preprocess(4, argc, argv, &scheme);
 
   // Set dimension.
   config[0] = (double)2; // Dimensionality = 2
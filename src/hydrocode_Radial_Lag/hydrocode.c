@@ -96,6 +96,7 @@
 #include <string.h>
 #include <math.h>
 
+#include "../include_cii/mem.h"
 #include "../include/var_struc.h"
 #include "../include/file_io.h"
 #include "../include/finite_volume.h"
@@ -124,23 +125,9 @@ double config[N_CONF]; //!< Initial configuration data array.
 
 #define CV_INIT_FV_RESET_MEM(v, N)					\
     do {								\
-	CV.v = (double **)malloc(N * sizeof(double *));			\
-	if(CV.v == NULL)						\
-	    {								\
-		printf("NOT enough memory! %s\n", #v);			\
-		retval = 5;						\
-		goto return_NULL;					\
-	    }								\
+	CV.v = (double **)ALLOC_TAG(N * sizeof(double *), "fields");	\
 	for(k = 0; k < N; ++k)						\
-	    {								\
-		CV.v[k] = (double *)malloc(Md * sizeof(double));	\
-		if(CV.v[k] == NULL)					\
-		    {							\
-			printf("NOT enough memory! %s[%d]\n", #v, k);	\
-			retval = 5;					\
-			goto return_NULL;				\
-		    }							\
-	    }								\
+	    CV.v[k] = (double *)ALLOC_TAG(Md * sizeof(double), "fields"); \
 	memmove(CV.v[0]+1, FV0.v, Ncell * sizeof(double));		\
 	free(FV0.v);							\
 	FV0.v = NULL;							\
@@ -169,7 +156,7 @@ int main(int argc, char *argv[])
       config[k] = INFINITY;
 
   char * scheme = NULL; // Riemann_exact(Godunov), GRP
-  arg_preprocess(4, argc, argv, scheme);
+  arg_preprocess(4, argc, argv, &scheme);
 
   // Set dimension.
   config[0] = (double)1; // Dimension of input data = 1
@@ -234,27 +221,13 @@ int main(int argc, char *argv[])
   FV0.gamma = CV.gamma[0];
   for(k = 1; k < N; ++k)
       {
-	  free(CV.gamma[k]);
+	  FREE(CV.gamma[k]);
 	  CV.gamma[k] = CV.gamma[0];
       }
 #endif
-  CV.E = (double **)malloc(N * sizeof(double *));
-  if(CV.E == NULL)
-      {
-	  printf("NOT enough memory! E\n");
-	  retval = 5;
-	  goto return_NULL;
-      }
+  CV.E = (double **)ALLOC_TAG(N * sizeof(double *), "fields");
   for(k = 0; k < N; ++k)
-  {
-    CV.E[k] = (double *)malloc(Md * sizeof(double));
-    if(CV.E[k] == NULL)
-    {
-      printf("NOT enough memory! E[%d]\n", k);
-      retval = 5;
-      goto return_NULL;
-    }
-  }
+    CV.E[k] = (double *)ALLOC_TAG(Md * sizeof(double), "fields");
   for(j = 1; j <= Ncell; ++j)
       {
 #ifdef MULTIFLUID_BASICS
@@ -300,32 +273,23 @@ return_NULL:
   FV0.P     = NULL;
   for(k = 0; k < N; ++k)
   {
-    free(CV.E[k]);
-    free(CV.RHO[k]);
-    free(CV.U[k]);
-    free(CV.P[k]);
+    FREE(CV.E[k]);
+    FREE(CV.RHO[k]);
+    FREE(CV.U[k]);
+    FREE(CV.P[k]);
     free(R[k]);
-    CV.E[k]     = NULL;
-    CV.RHO[k]   = NULL;
-    CV.U[k]     = NULL;
-    CV.P[k]     = NULL;
     R[k]        = NULL;
   }
-  free(CV.E);
-  free(CV.RHO);
-  free(CV.U);
-  free(CV.P);
-  CV.E     = NULL;
-  CV.RHO   = NULL;
-  CV.U     = NULL;
-  CV.P     = NULL;
+  FREE(CV.E);
+  FREE(CV.RHO);
+  FREE(CV.U);
+  FREE(CV.P);
 #ifdef MULTIFLUID_BASICS
   FV0.gamma = NULL;
-  free(CV.gamma[0]);
+  FREE(CV.gamma[0]);
   for(k = 0; k < N; ++k)
       CV.gamma[k] = NULL;
-  free(CV.gamma);
-  CV.gamma = NULL;
+  FREE(CV.gamma);
 #endif
   free(R);
   R = NULL;
@@ -1,6 +1,7 @@
 #!/bin/bash
 
 export LD_LIBRARY_PATH=lib:$LD_LIBRARY_PATH
+#export OMP_NUM_THREADS=4
 
 ### Run the program
 CPath=$(pwd)
@@ -16,13 +16,14 @@ int flu_var_count     (FILE * fp, const char * add);
 int flu_var_count_line(FILE * fp, const char * add, int * n_x);
 
 int flu_var_read(FILE * fp, double * U, const int num);
+int flu_var_write(FILE * fp, const double * U, const int num, const int n_col, const char * row_end);
 
 int time_plot_read(const char * add_in, const int N_max, int * N_plot, double * time_plot[]);
 
 //////////////////////////
 // terminal_io.c
 //////////////////////////
-void arg_preprocess(const int argc_least, const int argc, char *argv[], char * scheme);
+void arg_preprocess(const int argc_least, const int argc, char *argv[], char ** scheme);
 
 //////////////////////////
 // config_handle.c
@@ -71,5 +72,16 @@ void file_radial_write_TEC(const struct flu_var FV, const double * R, const char
 //////////////////////////
 void file_write_2D_BLOCK_TEC(const struct flu_var FV, const struct mesh_var mv, const char * problem, const double time);
 void file_write_3D_VTK      (const struct flu_var FV, const struct mesh_var mv, const char * problem, const double time);
+void file_write_2D_VTU      (const struct flu_var FV, const struct mesh_var mv, const char * problem, const double time);
+void file_write_2D_VTU_free (void);
+
+//////////////////////////
+// file_insitu_out.c
+//////////////////////////
+void insitu_init(const char * name);
+void insitu_2D_stru    (const int n_x, const int n_y, const struct cell_var_stru * CV, double ** X, double ** Y,
+			const char * problem, const int step, const double time, const _Bool last);
+void insitu_2D_unstruct(const struct cell_var * cv, const struct mesh_var * mv,
+			const char * problem, const int step, const double time, const _Bool last);
 
 #endif
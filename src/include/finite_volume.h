@@ -9,15 +9,11 @@
 
 #include "../include/var_struc.h"
 
-/* 1-D Godunov/GRP scheme (Lagrangian, single-component flow) */
+/* 1-D Godunov/GRP scheme (Eulerian/Lagrangian, single-component flow) */
 //////////////////////////////////////
-// godunov_solver_LAG_source.c
+// finite_volume_scheme_1D.c
 //////////////////////////////////////
-void Godunov_solver_LAG_source(const int m, struct cell_var_stru CV, double * X[], double * cpu_time, int * N_plot, double time_plot[]);
-//////////////////////////////////////
-// grp_solver_LAG_source.c
-//////////////////////////////////////
-void     GRP_solver_LAG_source(const int m, struct cell_var_stru CV, double * X[], double * cpu_time, int * N_plot, double time_plot[]);
+_Bool finite_volume_scheme_1D(const int m, struct cell_var_stru CV, double * X[], double * cpu_time, int * N_plot, double time_plot[]);
 
 /* radially symmertric Godunov/GRP scheme (Lagrangian, two-component flow, radial structured grid) */
 //////////////////////////////////////
@@ -26,16 +22,6 @@ void     GRP_solver_LAG_source(const int m, struct cell_var_stru CV, double * X[
 void GRP_solver_radial_LAG_source(struct cell_var_stru CV, struct radial_mesh_var * rmv, double * R[], const int M,
 				  double * cpu_time, const char * problem, int N_T, int * N_plot , double time_plot[]);
 
-/* 1-D Godunov/GRP scheme (Eulerian, single-component flow) */
-//////////////////////////////////////
-// godunov_solver_EUL_source.c
-//////////////////////////////////////
-void Godunov_solver_EUL_source(const int m, struct cell_var_stru CV, double * cpu_time, int * N_plot, double time_plot[]);
-//////////////////////////////////////
-// grp_solver_EUL_source.c
-//////////////////////////////////////
-void     GRP_solver_EUL_source(const int m, struct cell_var_stru CV, double * cpu_time, int * N_plot, double time_plot[]);
-
 /* 2-D Godunov/GRP scheme (Eulerian, single-component flow, structured grid) */
 //////////////////////////////////////
 // grp_solver_2D_EUL_source.c
@@ -47,6 +33,13 @@ void GRP_solver_2D_EUL_source(const int m, const int n, struct cell_var_stru * C
 //////////////////////////////////////
 void GRP_solver_2D_split_EUL_source(const int m, const int n, struct cell_var_stru * CV, double ** X, double **Y, 
                                     double * cpu_time, const char * problem, int N_T, int * N_plot, double time_plot[]);
+//////////////////////////////////////
+// grp_2D_task_step.c
+//////////////////////////////////////
+int GRP_2D_task_step(const int m, const int n, const int nt, const int k, struct cell_var_stru * CV,
+		     const struct b_f_var * bfv_L, const struct b_f_var * bfv_R, const struct b_f_var * bfv_D, const struct b_f_var * bfv_U,
+		     const double tau_x, const double tau_y, const _Bool Transversal,
+		     double * W_old, char * trouble, struct health_var * hv, int * n_trouble);
 
 /* 2-D Godunov/GRP scheme (Eulerian, two-component flow, unstructured grid) */
 //////////////////////////////////////
@@ -13,13 +13,21 @@
 /////////////////////////
 // flux_generator_x.c
 /////////////////////////
-int flux_generator_x(const int m, const int n, const int nt, const double tau, struct cell_var_stru * CV,
-		      struct b_f_var * bfv_L, struct b_f_var * bfv_R, const _Bool Transversal);
+int flux_generator_x(const int m, const int n, const int nt, const double tau, struct cell_var_stru * CV, const _Bool Transversal);
+int flux_generator_x_tile(const int nt, const double tau, struct cell_var_stru * CV, const _Bool Transversal,
+			  const int j_0, const int j_1, const int i_0, const int i_1);
 /////////////////////////
 // flux_generator_y.c
 /////////////////////////
-int flux_generator_y(const int m, const int n, const int nt, const double tau, struct cell_var_stru * CV,
-		      struct b_f_var * bfv_D, struct b_f_var * bfv_U, const _Bool Transversal);
+int flux_generator_y(const int m, const int n, const int nt, const double tau, struct cell_var_stru * CV, const _Bool Transversal);
+int flux_generator_y_tile(const int nt, const double tau, struct cell_var_stru * CV, const _Bool Transversal,
+			  const int j_0, const int j_1, const int i_0, const int i_1);
+
+/////////////////////////
+// flux_fallback_2D.c
+/////////////////////////
+int flux_fallback_2D(const int m, const int n, const int nt, const double nu, const double mu, struct cell_var_stru * CV,
+		     const double * W_old, char * trouble);
 
 /////////////////////////
 // flux_solver.c
@@ -31,5 +39,8 @@ int Riemann_exact_flux(struct i_f_var * ifv, struct i_f_var * ifv_R);
 // Flux of approximate Riemann solver (Eulerian, two-component flow)
 void Roe_flux(struct i_f_var * ifv, struct i_f_var * ifv_R);
 void HLL_flux(struct i_f_var * ifv, struct i_f_var * ifv_R);
+// Flux of the uniform state on a quiescent interface
+_Bool quiescent_check(const struct i_f_var * ifv, const struct i_f_var * ifv_R, const _Bool Slope);
+void uniform_2D_flux (struct i_f_var * ifv);
 
 #endif
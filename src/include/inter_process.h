@@ -9,12 +9,37 @@
 
 #include "../include/var_struc.h"
 
+struct radial_mesh_var;
+
 
 ///////////////////////////////////
 // fluid_var_check.c
 ///////////////////////////////////
 int ifvar_check(struct i_f_var *ifv_L, struct i_f_var *ifv_R, const int dim);
 int star_dire_check(double *mid, double *dire, const int dim);
+_Bool health_check(const struct health_var * hv, const int step, const double time);
+void health_sum_2D_stru(const int m, const int n, const struct cell_var_stru * CV, struct health_var * hv);
+
+
+///////////////////////////////////
+// mesh_velocity_1D.c
+///////////////////////////////////
+/**
+ * @brief Strategy to compute the velocity W of the grid nodes of the 1-D ALE scheme.
+ * @details Arguments: W, m, tau, X, RHO of grid cells, and RHO/U/P on the left and right sides of the grid nodes.
+ */
+typedef void (*Mesh_Velocity_1D)(double * W, const int m, const double tau, const double * X, const double * RHO,
+				 const double * RHO_L, const double * U_L, const double * P_L,
+				 const double * RHO_R, const double * U_R, const double * P_R);
+void mesh_velocity_EUL(double * W, const int m, const double tau, const double * X, const double * RHO,
+		       const double * RHO_L, const double * U_L, const double * P_L,
+		       const double * RHO_R, const double * U_R, const double * P_R);
+void mesh_velocity_LAG(double * W, const int m, const double tau, const double * X, const double * RHO,
+		       const double * RHO_L, const double * U_L, const double * P_L,
+		       const double * RHO_R, const double * U_R, const double * P_R);
+void mesh_velocity_adaptive(double * W, const int m, const double tau, const double * X, const double * RHO,
+			    const double * RHO_L, const double * U_L, const double * P_L,
+			    const double * RHO_R, const double * U_R, const double * P_R);
 
 
 ///////////////////////////////////
@@ -26,7 +51,7 @@ void minmod_limiter(const _Bool NO_h, const int m, const _Bool i_f_var_get, doub
 // slope_limiter_2D_x.c
 ///////////////////////////////////
 void minmod_limiter_2D_x(const _Bool NO_h, const int m, const int i, const _Bool i_f_var_x_get, double ** s,
-			 double ** U, const double UL, const double UR, const double HL, ...);
+			 double ** U, const double HL, ...);
 ///////////////////////////////////
 // slope_limiter_radial.c
 ///////////////////////////////////
@@ -49,11 +74,19 @@ _Bool bound_cond_slope_limiter(const _Bool NO_h, const int m, const int nt, stru
 // bound_cond_slope_limiter_x.c
 ///////////////////////////////////
 _Bool bound_cond_slope_limiter_x(const int m, const int n, const int nt, struct cell_var_stru * CV, struct b_f_var * bfv_L, struct b_f_var * bfv_R,
-				 struct b_f_var * bfv_D, struct b_f_var * bfv_U, _Bool find_bound_x, const _Bool Slope, const double t_c);
+				 _Bool find_bound_x, const _Bool Slope, const double t_c);
+void bound_cond_slope_limiter_x_rows(const int m, const int n, const int nt, struct cell_var_stru * CV,
+				     const struct b_f_var * bfv_L, const struct b_f_var * bfv_R,
+				     const _Bool find_bound_x, const _Bool Slope, const int i_0, const int i_1);
+void ghost_slope_x_trans(const int m, const int n, struct cell_var_stru * CV);
 ///////////////////////////////////
 // bound_cond_slope_limiter_y.c
 ///////////////////////////////////
-_Bool bound_cond_slope_limiter_y(const int m, const int n, const int nt, struct cell_var_stru * CV, struct b_f_var * bfv_L, struct b_f_var * bfv_R,
-				 struct b_f_var * bfv_D, struct b_f_var * bfv_U, _Bool find_bound_y, const _Bool Slope, const double t_c);
+_Bool bound_cond_slope_limiter_y(const int m, const int n, const int nt, struct cell_var_stru * CV, struct b_f_var * bfv_D, struct b_f_var * bfv_U,
+				 _Bool find_bound_y, const _Bool Slope, const double t_c);
+void bound_cond_slope_limiter_y_cols(const int m, const int n, const int nt, struct cell_var_stru * CV,
+				     const struct b_f_var * bfv_D, const struct b_f_var * bfv_U,
+				     const _Bool find_bound_y, const _Bool Slope, const int j_0, const int j_1);
+void ghost_slope_y_trans(const int m, const int n, struct cell_var_stru * CV);
 
 #endif
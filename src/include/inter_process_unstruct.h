@@ -43,16 +43,26 @@ void slope_limiter_prim(const struct cell_var * cv,const struct mesh_var * mv, c
 void cons_qty_copy_cv2ifv(struct i_f_var * ifv, const struct cell_var * cv, const int c);
 void cons_qty_copy_ifv2cv(const struct i_f_var * ifv, struct cell_var * cv, const int c);
 void prim_var_copy_ifv2FV(const struct i_f_var * ifv, const struct flu_var * FV,const int c);
+void prim_var_copy_ifv2cv(const struct i_f_var * ifv, const struct cell_var * cv, const int c);
+void prim_var_copy_cv2ifv(struct i_f_var * ifv, const struct cell_var * cv, const int c);
 void flux_copy_ifv2cv(const struct i_f_var * ifv, const struct cell_var *cv, const int k, const int j);
 void flux_add_ifv2cv(const struct i_f_var * ifv, const struct cell_var * cv, const int k, const int j);
+void cell_pack_scatter(const struct cell_var * cv, const int c);
+void cell_pack_update(const struct cell_var * cv, const struct mesh_var * mv);
+void cons_qty_copy_pack2ifv(struct i_f_var * ifv, const struct cell_var * cv, const int c);
+void prim_var_copy_pack2ifv(struct i_f_var * ifv, const struct cell_var * cv, const int c);
+void grad_copy_cv2arr(double grad[PK_NUM], const struct cell_var * cv, const int c);
 
 /////////////////////////
 // assist_func.c
 /////////////////////////
-int fluid_var_update(struct flu_var *FV, struct cell_var *cv);
+int fluid_var_update(struct flu_var *FV, struct cell_var *cv, struct health_var *hv);
 int interface_var_init(const struct cell_var * cv, const struct mesh_var * mv,
 					   struct i_f_var * ifv, struct i_f_var * ifv_R,
 					   const int k, const int j, const int i, const double gauss);
+int interface_var_init_ij(const struct cell_var * cv, const struct mesh_var * mv,
+						  struct i_f_var * ifv, struct i_f_var * ifv_R,
+						  const int x, const int y, const int j, const int i, const double gauss);
 double tau_calc(const struct cell_var * cv, const struct mesh_var * mv);
 
 #endif
@@ -25,6 +25,13 @@ void Saltzman_Lag_mesh       (struct mesh_var * mv);
 //////////////////////////
 int msh_read(FILE * fp, struct mesh_var * mv);
 
+//////////////////////////
+// mesh_cache.c
+//////////////////////////
+unsigned long long mesh_file_hash(FILE * fp);
+void mesh_cache_write(const char * add, const unsigned long long hash, const struct mesh_var * mv);
+int  mesh_cache_read (const char * add, const unsigned long long hash, struct mesh_var * mv);
+
 //////////////////////////
 // mesh_int_free.c
 //////////////////////////
@@ -32,6 +32,14 @@ double Riemann_solver_starPU(double * U_star, double * P_star, const double Gamm
 			   const double UL, const double UR, const double PL, const double PR,
 			   const double CL, const double CR, _Bool * CRW,
 			   const double eps, const double TOLPRE, const int NRITER);
+//////////////////////////////////////
+// riemann_solver_adaptive.c
+//////////////////////////////////////
+double Riemann_solver_adaptive(double * U_star, double * P_star, const double gammaL, const double gammaR,
+			       const double rho_L, const double rho_R, const double u_L, const double u_R,
+			       const double p_L, const double p_R, const double c_L, const double c_R, _Bool * CRW,
+			       const double eps, const double tol, const int N, const double Q);
+void Riemann_solver_adaptive_count(long long num[3]);
 /* exact Riemann solver (single-component flow) */
 //////////////////////////////////////
 // riemann_solver_exact_Ben.c
@@ -64,6 +72,7 @@ void linear_GRP_solver_Edir(double *D, double *U, const struct i_f_var *ifv_L, c
 // linear_grp_solver_Edir_Q1D.c
 //////////////////////////////////////
 void linear_GRP_solver_Edir_Q1D(double *wave_speed, double *D, double *U, double *U_star, const struct i_f_var *ifv_L, const struct i_f_var *ifv_R, const double  eps, const double atc);
+long long linear_GRP_solver_Edir_Q1D_unconverged(void);
 //////////////////////////////////////
 // linear_grp_solver_Edir_G2D.c
 //////////////////////////////////////
@@ -7,6 +7,9 @@
 #ifndef TOOLS_H
 #define TOOLS_H
 
+#include <math.h>
+#include <stddef.h>
+
 #define MAX(a,b) (((a) > (b)) ? (a) : (b))
 
 /* minmod function */
@@ -18,6 +21,15 @@ inline double minmod2(const double s_L, const double s_R)                   __at
 inline double minmod3(const double s_L, const double s_R, const double s_m) __attribute__((always_inline));
 #endif
 
+/* fast power functions, the macro NOFASTMATH falls back to pow() of libm */
+#ifdef _WIN32
+inline double pow_int_fast(const double x, const int n);
+inline double pow_lin_fast(const double x, const double b, const double x_a, const int k, const int n);
+#elif __linux__
+inline double pow_int_fast(const double x, const int n)                                                 __attribute__((always_inline));
+inline double pow_lin_fast(const double x, const double b, const double x_a, const int k, const int n) __attribute__((always_inline));
+#endif
+
 //////////////////////////
 // sys_pro.c
 //////////////////////////
@@ -25,9 +37,75 @@ void DispPro(const double pro, const int step);
 
 int CreateDir(const char* pPath);
 
+double wall_time(void);
+double wall_time_stage(const char * stage, const double tic);
+
+#define HASH_FNV1A_INIT 14695981039346656037ULL //!< Offset basis of the FNV-1a hash.
+unsigned long long hash_fnv1a(unsigned long long h, const void * data, const size_t nbytes);
+
 void init_mem (double * p[], const int n, int ** cell_pt);
 void init_mem_int(int * p[], const int n, int ** cell_pt);
 
+double ** ghost_mem_2D(const int M, const int N, const int g);
+void ghost_mem_free_2D(double ** v, const int g);
+
+//////////////////////////
+// timeline.c
+//////////////////////////
+/*
+ * Timeline tracing of the solver phases if TIMELINE is defined, e.g.
+ *     TL_BEGIN(tl);  ... the phase ...  TL_END("flux x", tl);
+ * The name must be a string literal.
+ */
+#if defined TIMELINE || defined ROOFLINE
+#define TL_BEGIN(tl)      double const tl = wall_time()
+#else
+#define TL_BEGIN(tl)
+#endif
+#ifdef TIMELINE
+void timeline_event(const char * name, const double t0);
+#define TL_END(name, tl)  timeline_event((name), (tl))
+#elif defined ROOFLINE
+#define TL_END(name, tl)  ((void)(tl))
+#else
+#define TL_END(name, tl)  ((void)0)
+#endif
+
+//////////////////////////
+// roofline.c
+//////////////////////////
+/*
+ * Analytical bytes and flops of the solver phases with their measured time if ROOFLINE is defined, e.g.
+ *     TL_BEGIN(tl);  ... the phase ...  RL_END("flux x", tl, RL_FLUX_2D, 0, (m+1)*n);
+ * which also ends the timeline event of the phase.
+ */
+//! Kernels with the counts per grid cell and per cell interface in roofline.c.
+enum roofline_kernel {
+    RL_CFL_2D, RL_LIMITER_2D, RL_FLUX_2D, RL_FLUX_2D_SPLIT, RL_UPDATE_2D, RL_UPDATE_2D_X, RL_UPDATE_2D_Y,
+    RL_TASK_2D, RL_TASK_2D_X, RL_TASK_2D_Y,
+    RL_CFL_UNSTRUCT, RL_LIMITER_UNSTRUCT, RL_FLUX_UNSTRUCT, RL_UPDATE_UNSTRUCT,
+    RL_N
+};
+#ifdef ROOFLINE
+void roofline_add(const char * name, const double t0, const int kernel, const double n_cell, const double n_edge);
+#define RL_END(name, tl, kernel, n_cell, n_edge)  roofline_add((name), (tl), (kernel), (double)(n_cell), (double)(n_edge))
+#else
+#define RL_END(name, tl, kernel, n_cell, n_edge)  TL_END((name), (tl))
+#endif
+
+//////////////////////////
+// omp_tune.c
+//////////////////////////
+//! Kernels tuned in omp_tune.c.
+enum omp_tune_kernel {
+    TUNE_LIMITER_X, TUNE_LIMITER_Y, TUNE_FLUX_X, TUNE_FLUX_Y, TUNE_UPDATE, TUNE_UPDATE_X, TUNE_UPDATE_Y, TUNE_TILE,
+    TUNE_N
+};
+void omp_tune_init(const int m, const int n);
+int  omp_tune_begin(const int kernel);
+void omp_tune_end(const int kernel);
+void omp_tune_save(void);
+
 //////////////////////////
 // mat_algo.c
 //////////////////////////
@@ -72,4 +150,38 @@ inline double minmod3(const double s_L, const double s_R, const double s_m)
 	return s_L;
 }
 
+/**
+ * @brief Integer power x^n by repeated multiplication.
+ * @details For a constant n the loop is unrolled by the compiler, e.g. x^3 costs two products instead of a call of pow().
+ *          The relative error is bounded by |n|/2 ULP (+ 1/2 ULP for n < 0), while pow() is correctly rounded within 1 ULP.
+ */
+inline double pow_int_fast(const double x, const int n)
+{
+#ifdef NOFASTMATH
+    return pow(x, (double)n);
+#else
+    double y = 1.0;
+    for(int i = 0; i < (n < 0 ? -n : n); ++i)
+	y *= x;
+    return n < 0 ? 1.0/y : y;
+#endif
+}
+
+/**
+ * @brief Power x^b with the exponent b = k*a + n (k, n small integers) derived from a known power x_a = x^a.
+ * @details The exponents of a γ-law gas are linearly related, e.g. (γ+1)/(2γ) = 1 - (γ-1)/(2γ) and 1/γ = 1 - 2(γ-1)/(2γ),
+ *          so that one pow() per base and per material serves all of them: x^b = x_a^k * x^n.
+ *          The relative error is bounded by |k|*err(x_a) + (|k|+|n|)/2 + 1 ULP, i.e. 3-4 ULP for the exponents used in the Riemann solvers.
+ */
+inline double pow_lin_fast(const double x, const double b, const double x_a, const int k, const int n)
+{
+#ifdef NOFASTMATH
+    (void)x_a; (void)k; (void)n;
+    return pow(x, b);
+#else
+    (void)b;
+    return pow_int_fast(x_a, k)*pow_int_fast(x, n);
+#endif
+}
+
 #endif
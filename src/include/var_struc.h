@@ -43,6 +43,15 @@
 
 extern double config[]; //!< Initial configuration data array.
 
+/**
+ * @brief Width of the ghost layers around the structured 2-D fields.
+ * @details RHO, U, V, P, E and the slopes of cell_var_stru are indexed [-N_GHOST…n_x-1+N_GHOST][-N_GHOST…n_y-1+N_GHOST],
+ *          1 is enough for the second-order GRP scheme.
+ */
+#ifndef N_GHOST
+#define N_GHOST 1
+#endif
+
 
 //! pointer structure of FLUid VARiables array.
 typedef struct flu_var {
@@ -59,11 +68,11 @@ typedef struct flu_var {
 
 //! pointer structure of VARiables on STRUctural computational grid CELLs.
 typedef struct cell_var_stru {
-	double **    E;                      //!< specific total energy.
-	double **  RHO, **  U, **  V, **  P; //!< density, velocity components in direction x and y, pressure.
+	double **    E;                      //!< specific total energy (with N_GHOST ghost layers).
+	double **  RHO, **  U, **  V, **  P; //!< density, velocity components in direction x and y, pressure (with N_GHOST ghost layers).
 	double * d_rho, * d_u, * d_v, * d_p; //!< spatial derivatives in one dimension.
-	double **s_rho, **s_u, **s_v, **s_p; //!< spatial derivatives in coordinate x (slopes).
-	double **t_rho, **t_u, **t_v, **t_p; //!< spatial derivatives in coordinate y (slopes).
+	double **s_rho, **s_u, **s_v, **s_p; //!< spatial derivatives in coordinate x (slopes, with N_GHOST ghost layers).
+	double **t_rho, **t_u, **t_v, **t_p; //!< spatial derivatives in coordinate y (slopes, with N_GHOST ghost layers).
 	double **rhoIx, **uIx, **vIx, **pIx; //!< interfacial variable values in coordinate x at t_{n+1}.
 	double **rhoIy, **uIy, **vIy, **pIy; //!< interfacial variable values in coordinate y at t_{n+1}.
 	double **F_rho, **F_e, **F_u, **F_v; //!< numerical fluxes at (x_{j-1/2}, t_{n}).
@@ -74,6 +83,35 @@ typedef struct cell_var_stru {
 } Cell_Variable_Structured;
 
 
+/**
+ * @brief Number of grid cells interleaved in a block of the packed per-cell state 'cell_var.pack'.
+ * @details The 4 doubles of a 256-bit SIMD register by default, 1 gives an array of structures.
+ */
+#ifndef CELL_PACK_W
+#define CELL_PACK_W 4
+#endif
+
+//! Serial numbers of the variables of a grid cell in the packed per-cell state 'cell_var.pack'.
+enum cell_pack_var {
+	PK_U_RHO, PK_U_E, PK_U_U, PK_U_V,           //!< conservative variables.
+	PK_RHO, PK_P, PK_U, PK_V,                   //!< cached primitive variables.
+	PK_GX_RHO, PK_GX_E, PK_GX_U, PK_GX_V,       //!< gradients in coordinate x.
+	PK_GY_RHO, PK_GY_E, PK_GY_U, PK_GY_V,       //!< gradients in coordinate y.
+#ifdef MULTIFLUID_BASICS
+	PK_U_PHI, PK_U_E_A, PK_U_GAMMA,
+	PK_PHI, PK_Z_A, PK_GAMMA,
+	PK_GX_Z_A, PK_GY_Z_A, PK_GX_PHI, PK_GY_PHI,
+#endif
+	PK_NUM //!< number of the packed variables of a grid cell.
+};
+
+/**
+ * @brief Variable v of grid cell c in the packed per-cell state of 'cv'.
+ * @details The cells are grouped in blocks of CELL_PACK_W cells, a block holds all PK_NUM variables of its cells
+ *          and the values of one variable in a block are adjacent (AoSoA).
+ */
+#define CELL_PACK(cv, c, v) ((cv)->pack[(((c)/CELL_PACK_W)*PK_NUM + (v))*CELL_PACK_W + (c)%CELL_PACK_W])
+
 //! pointer structure of VARiables on unstructured computational grid CELLs.
 typedef struct cell_var {
 	/**
@@ -90,7 +128,11 @@ typedef struct cell_var {
 	double **   RHO_p, **   U_p, **   V_p, **   P_p;
 	double *gradx_rho, *gradx_e, *gradx_u, *gradx_v; //!< spatial derivatives in coordinate x (gradients).
 	double *grady_rho, *grady_e, *grady_u, *grady_v; //!< spatial derivatives in coordinate y (gradients).
+	double *      RHO, *      U, *      V, *      P; //!< primitive variables cached once per time step.
+	double *c;                                       //!< sound speed cached once per time step.
+	double *pack; //!< optional packed per-cell state gathered by the face kernels, NULL for the separate arrays.
 #ifdef MULTIFLUID_BASICS
+	double *Z_a, *PHI, *gamma; //!< cached volume fraction, mass fraction and specific heat ratio.
 	double **F_e_a,   *U_e_a,   **Z_a_p,   *gradx_z_a,   *grady_z_a;   //!< Total energy OR volume fraction of fluid a.
 	double **F_phi,   *U_phi,   **PHI_p,   *gradx_phi,   *grady_phi;   //!< Mass fraction of fluid a.
 	double **F_gamma, *U_gamma, **gamma_p, *gradx_gamma, *grady_gamma; //!< Specific heat ratio.
@@ -107,7 +149,7 @@ typedef struct cell_var {
 #ifdef LAGRANGIAN_MAIRE
 	double **F_p_x,  **F_p_y;
 	double **dt_U_p, **dt_V_p, **dt_F_p_x, **dt_F_p_y;
-	double  *c, *dist_p;
+	double  *dist_p;
 #endif
 } Cell_Variable;
 
@@ -151,9 +193,19 @@ typedef struct b_f_var {
 } Boundary_Fluid_Variable;
 
 
+//! HEALTH monitor VARiables reduced over grid cells in one time step.
+typedef struct health_var {
+	double mass, mom_x, mom_y, ene; //!< total mass, momentum components and total energy.
+	double rho_min, p_min;          //!< minimum density and pressure.
+	double Ma_max;                  //!< maximum Mach number.
+	int    n_nan;                   //!< number of grid cells with NAN or INFinite variables.
+} Health_Variable;
+
+
 //! MESHing VARiables.
 typedef struct mesh_var {
 	int num_pt;      //!< Total number of grid nodes.
+	int n_x, n_y;    //!< Numbers of the x- and y-grids of a logically structured quadrilateral mesh, 0 for the other meshes.
 	int num_ghost;   //!< Total number of ghost grid cells.
 	int **cell_pt;   //!< Serial number of each grid node on a grid cell in the clockwise direction.
 	int * cell_type; //!< @todo Grid cell type read from mesh file '*.msh' 
@@ -170,6 +222,11 @@ typedef struct mesh_var {
 	 */
 	int *border_cond;
 	int *period_cell; //!< Serial number of ghost grid cells at the periodic boundary.
+	/**
+	 * @brief Topological relationships between grid cells, searched once while the mesh is built or read from the mesh cache.
+	 *  @arg  cell_cell[i][j], serial number of the adjacent cell (or boundary condition indicator) to the j-th interface of the i-th cell.
+	 */
+	int **cell_cell;
 	double *normal_v; //!< @todo Normal velocity on grid cell interfaces at the boundary.
 	double *X, *Y;    //!< x- and y-coordinates of the grid nodes with fixed serial number.
 	//! Pointer to the boundary condition function.
@@ -16,10 +16,16 @@ extern void Mem_free(void *ptr,
 	const char *file, int line);
 extern void *Mem_resize(void *ptr, long nbytes,
 	const char *file, int line);
+extern void Mem_stat_print(void);
 #define ALLOC(nbytes) \
 	Mem_alloc((nbytes), __FILE__, __LINE__)
 #define CALLOC(count, nbytes) \
 	Mem_calloc((count), (nbytes), __FILE__, __LINE__)
+/* Allocations accounted under the tag instead of the source file if MEM_STAT is defined. */
+#define ALLOC_TAG(nbytes, tag) \
+	Mem_alloc((nbytes), (tag), 0)
+#define CALLOC_TAG(count, nbytes, tag) \
+	Mem_calloc((count), (nbytes), (tag), 0)
 #define  NEW(p) ((p) = ALLOC((long)sizeof *(p)))
 #define NEW0(p) ((p) = CALLOC(1, (long)sizeof *(p)))
 #define FREE(ptr) ((void)(Mem_free((ptr), \
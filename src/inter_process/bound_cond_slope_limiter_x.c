@@ -1,129 +1,245 @@
 /**
  * @file  bound_cond_slope_limiter_x.c
  * @brief This is a function to set boundary conditions and use the slope limiter in x-direction of two dimension.
+ * @details The boundary conditions fill the N_GHOST ghost layers of the structured fields before the slope limiter of each row,
+ *          so that the slope limiter and the flux generator run over the interior without boundary branches.
  */
 #include <stdio.h>
 #include <stdbool.h>
 
 #include "../include/var_struc.h"
 #include "../include/inter_process.h"
+#include "../include/tools.h"
 
 
 /**
- * @brief This function apply the minmod limiter to the slope in the x-direction of two dimension.
+ * @brief This function copies the fluid variables of the grid cell [js][i] to the ghost grid cell [jg][i].
+ * @param[in,out] CV:  Structure of cell variable data at the current plot time step.
+ * @param[in] jg:      x-index of the ghost grid cell.
+ * @param[in] js:      x-index of the source grid cell.
+ * @param[in] i:       y-index of the grid cells.
+ * @param[in] sign_u:  -1.0 for reflective boundary, 1.0 otherwise.
+ */
+static inline void ghost_copy_x(struct cell_var_stru * CV, const int jg, const int js, const int i, const double sign_u)
+{
+    CV->RHO[jg][i] = CV->RHO[js][i];
+    CV->U[jg][i]   = sign_u*CV->U[js][i];
+    CV->V[jg][i]   = CV->V[js][i];
+    CV->P[jg][i]   = CV->P[js][i];
+}
+
+/**
+ * @brief This function copies the x-slopes of the grid cell [js][i] to the ghost grid cell [jg][i].
+ * @param[in,out] CV:  Structure of cell variable data.
+ * @param[in] jg:      x-index of the ghost grid cell.
+ * @param[in] js:      x-index of the source grid cell.
+ * @param[in] i:       y-index of the grid cells.
+ */
+static inline void ghost_slope_x(struct cell_var_stru * CV, const int jg, const int js, const int i)
+{
+    CV->s_rho[jg][i] = CV->s_rho[js][i];
+    CV->s_u[jg][i]   = CV->s_u[js][i];
+    CV->s_v[jg][i]   = CV->s_v[js][i];
+    CV->s_p[jg][i]   = CV->s_p[js][i];
+}
+
+/**
+ * @brief This function fills the ghost grid cells in x-direction and apply the minmod limiter to the slope in the x-direction
+ *        on the rows [i_0, i_1) of two dimension.
+ * @details The boundary conditions in x-direction should have been found by bound_cond_slope_limiter_x().
+ *          The work on a row only touches this row, so that the rows can be shared among threads or tasks in any order.
  * @param[in] m:          Number of the x-grids: n_x.
  * @param[in] n:          Number of the y-grids: n_y.
  * @param[in] nt:         Current plot time step for computing updates of conservative variables.
- * @param[in] CV:         Structure of cell variable data.
- * @param[in,out] bfv_L:  Fluid variables at left boundary.
- * @param[in,out] bfv_R:  Fluid variables at right boundary.
- * @param[in,out] bfv_D:  Fluid variables at downside boundary.
- * @param[in,out] bfv_U:  Fluid variables at upper boundary.
+ * @param[in,out] CV:     Structure of cell variable data.
+ * @param[in] bfv_L:      Fluid variables at left boundary, only for the initial boundary conditions.
+ * @param[in] bfv_R:      Fluid variables at right boundary, only for the initial boundary conditions.
  * @param[in] find_bound_x: Whether the boundary conditions in x-direction have been found.
  * @param[in] Slope:      Are there slopes? (true: 2nd-order / false: 1st-order)
- * @param[in] t_c:        Time of current time step.
- * @return find_bound_x:  Whether the boundary conditions in x-direction have been found.
+ * @param[in] i_0, i_1:   Range of the y-indices of the rows.
  */
-_Bool bound_cond_slope_limiter_x(const int m, const int n, const int nt, struct cell_var_stru * CV, struct b_f_var * bfv_L, struct b_f_var * bfv_R,
-				 struct b_f_var * bfv_D, struct b_f_var * bfv_U, _Bool find_bound_x, const _Bool Slope, const double t_c)
+void bound_cond_slope_limiter_x_rows(const int m, const int n, const int nt, struct cell_var_stru * CV,
+				     const struct b_f_var * bfv_L, const struct b_f_var * bfv_R,
+				     const _Bool find_bound_x, const _Bool Slope, const int i_0, const int i_1)
 {
     int const bound_x = (int)(config[17]);// the boundary condition in x-direction
-    int const bound_y = (int)(config[18]);// the boundary condition in y-direction
     double const h_x  = config[10];       // the length of the initial x-spatial grids
-    int i, j;
-    for(i = 0; i < n; ++i)
-	switch (bound_x)
-	    {
-	    case -1: // initial boudary conditions
-		if(find_bound_x)
-		    break;
-		else if(!i)
-		    printf("Initial boudary conditions in x direction at time %g .\n", t_c);
-		bfv_L[i].U   =   CV->U[0][i]; bfv_R[i].U   =   CV->U[m-1][i];
-		bfv_L[i].V   =   CV->V[0][i]; bfv_R[i].V   =   CV->V[m-1][i];
-		bfv_L[i].P   =   CV->P[0][i]; bfv_R[i].P   =   CV->P[m-1][i];
-		bfv_L[i].RHO = CV->RHO[0][i]; bfv_R[i].RHO = CV->RHO[m-1][i];
-		break;
-	    case -2: // reflective boundary conditions
-		if(!find_bound_x && !i)
-		    printf("Reflective boudary conditions in x direction.\n");
-		bfv_L[i].U   = - CV[nt].U[0][i]; bfv_R[i].U   = - CV[nt].U[m-1][i];
-		bfv_L[i].V   =   CV[nt].V[0][i]; bfv_R[i].V   =   CV[nt].V[m-1][i];
-		bfv_L[i].P   =   CV[nt].P[0][i]; bfv_R[i].P   =   CV[nt].P[m-1][i];
-		bfv_L[i].RHO = CV[nt].RHO[0][i]; bfv_R[i].RHO = CV[nt].RHO[m-1][i];
-		break;
-	    case -4: // free boundary conditions
-		if(!find_bound_x && !i)
-		    printf("Free boudary conditions in x direction.\n");
-		bfv_L[i].U   =   CV[nt].U[0][i]; bfv_R[i].U   =   CV[nt].U[m-1][i];
-		bfv_L[i].V   =   CV[nt].V[0][i]; bfv_R[i].V   =   CV[nt].V[m-1][i];
-		bfv_L[i].P   =   CV[nt].P[0][i]; bfv_R[i].P   =   CV[nt].P[m-1][i];
-		bfv_L[i].RHO = CV[nt].RHO[0][i]; bfv_R[i].RHO = CV[nt].RHO[m-1][i];
-		break;
-	    case -7: // periodic boundary conditions
-		if(!find_bound_x && !i)
-		    printf("Periodic boudary conditions in x direction.\n");
-		bfv_L[i].U   =   CV[nt].U[m-1][i]; bfv_R[i].U   =   CV[nt].U[0][i];
-		bfv_L[i].V   =   CV[nt].V[m-1][i]; bfv_R[i].V   =   CV[nt].V[0][i];
-		bfv_L[i].P   =   CV[nt].P[m-1][i]; bfv_R[i].P   =   CV[nt].P[0][i];
-		bfv_L[i].RHO = CV[nt].RHO[m-1][i]; bfv_R[i].RHO = CV[nt].RHO[0][i];
-		break;
-	    case -24: // reflective + free boundary conditions
-		if(!find_bound_x && !i)
-		    printf("Reflective + Free boudary conditions in x direction.\n");
-		bfv_L[i].U   = - CV[nt].U[0][i]; bfv_R[i].U   =   CV[nt].U[m-1][i];
-		bfv_L[i].V   =   CV[nt].V[0][i]; bfv_R[i].V   =   CV[nt].V[m-1][i];
-		bfv_L[i].P   =   CV[nt].P[0][i]; bfv_R[i].P   =   CV[nt].P[m-1][i];
-		bfv_L[i].RHO = CV[nt].RHO[0][i]; bfv_R[i].RHO = CV[nt].RHO[m-1][i];
-		break;
-	    default:
-		printf("No suitable boundary coditions in x direction!\n");
-		return false;
-	    }
-    if (Slope)
+    int i, g;
+    for(i = i_0; i < i_1; ++i)
 	{
-#pragma omp parallel for  schedule(dynamic, 8)
-	    for(i = 0; i < n; ++i)
+	    switch (bound_x)
 		{
-		    minmod_limiter_2D_x(false, m, i, find_bound_x, CV->s_u,   CV[nt].U,   bfv_L[i].U,   bfv_R[i].U,   h_x);
-		    minmod_limiter_2D_x(false, m, i, find_bound_x, CV->s_v,   CV[nt].V,   bfv_L[i].V,   bfv_R[i].V,   h_x);
-		    minmod_limiter_2D_x(false, m, i, find_bound_x, CV->s_p,   CV[nt].P,   bfv_L[i].P,   bfv_R[i].P,   h_x);
-		    minmod_limiter_2D_x(false, m, i, find_bound_x, CV->s_rho, CV[nt].RHO, bfv_L[i].RHO, bfv_R[i].RHO, h_x);
-		} // End of parallel region
+		case -1: // initial boudary conditions
+		    for(g = 1; g <= N_GHOST; ++g)
+			{
+			    CV[nt].U[-g][i]   = bfv_L[i].U;   CV[nt].U[m-1+g][i]   = bfv_R[i].U;
+			    CV[nt].V[-g][i]   = bfv_L[i].V;   CV[nt].V[m-1+g][i]   = bfv_R[i].V;
+			    CV[nt].P[-g][i]   = bfv_L[i].P;   CV[nt].P[m-1+g][i]   = bfv_R[i].P;
+			    CV[nt].RHO[-g][i] = bfv_L[i].RHO; CV[nt].RHO[m-1+g][i] = bfv_R[i].RHO;
+			}
+		    break;
+		case -2: // reflective boundary conditions
+		    for(g = 1; g <= N_GHOST; ++g)
+			{
+			    ghost_copy_x(CV+nt, -g,    g-1, i, -1.0);
+			    ghost_copy_x(CV+nt, m-1+g, m-g, i, -1.0);
+			}
+		    break;
+		case -4: // free boundary conditions
+		    for(g = 1; g <= N_GHOST; ++g)
+			{
+			    ghost_copy_x(CV+nt, -g,    0,   i, 1.0);
+			    ghost_copy_x(CV+nt, m-1+g, m-1, i, 1.0);
+			}
+		    break;
+		case -7: // periodic boundary conditions
+		    for(g = 1; g <= N_GHOST; ++g)
+			{
+			    ghost_copy_x(CV+nt, -g,    m-g, i, 1.0);
+			    ghost_copy_x(CV+nt, m-1+g, g-1, i, 1.0);
+			}
+		    break;
+		case -24: // reflective + free boundary conditions
+		    for(g = 1; g <= N_GHOST; ++g)
+			{
+			    ghost_copy_x(CV+nt, -g,    g-1, i, -1.0);
+			    ghost_copy_x(CV+nt, m-1+g, m-1, i,  1.0);
+			}
+		    break;
+		}
+	    if (!Slope)
+		continue;
+	    minmod_limiter_2D_x(false, m, i, find_bound_x, CV->s_u,   CV[nt].U,   h_x);
+	    minmod_limiter_2D_x(false, m, i, find_bound_x, CV->s_v,   CV[nt].V,   h_x);
+	    minmod_limiter_2D_x(false, m, i, find_bound_x, CV->s_p,   CV[nt].P,   h_x);
+	    minmod_limiter_2D_x(false, m, i, find_bound_x, CV->s_rho, CV[nt].RHO, h_x);
 
-	    for(i = 0; i < n; ++i)
-		switch(bound_x)
+	    // x-slopes of the ghost grid cells in x-direction, the others stay zero.
+	    switch(bound_x)
+		{
+		case -2: // reflective boundary conditions
+		    for(g = 1; g <= N_GHOST; ++g)
+			{
+			    CV->s_u[-g][i] = CV->s_u[g-1][i]; CV->s_u[m-1+g][i] = CV->s_u[m-g][i];
+			}
+		    break;
+		case -7: // periodic boundary conditions
+		    for(g = 1; g <= N_GHOST; ++g)
+			{
+			    ghost_slope_x(CV, -g,    m-g, i);
+			    ghost_slope_x(CV, m-1+g, g-1, i);
+			}
+		    break;
+		case -24: // reflective + free boundary conditions
+		    for(g = 1; g <= N_GHOST; ++g)
+			CV->s_u[-g][i] = CV->s_u[g-1][i];
+		    break;
+		}
+	}
+}
+
+/**
+ * @brief This function fills the x-slopes of the ghost grid cells in y-direction for the transversal terms.
+ * @details It reads the x-slopes of the first and last N_GHOST rows, the others stay zero.
+ * @param[in] m:      Number of the x-grids: n_x.
+ * @param[in] n:      Number of the y-grids: n_y.
+ * @param[in,out] CV: Structure of cell variable data.
+ */
+void ghost_slope_x_trans(const int m, const int n, struct cell_var_stru * CV)
+{
+    int const bound_y = (int)(config[18]);// the boundary condition in y-direction
+    int j, g;
+    switch(bound_y)
+	{
+	case -2: case -4: case -24: // reflective OR free boundary conditions in y-direction
+#pragma omp parallel for private(g)
+	    for(j = 0; j < m; ++j)
+		for(g = 1; g <= N_GHOST; ++g)
 		    {
-		    case -2: // reflective boundary conditions
-			bfv_L[i].SU   =   CV->s_u[0][i];   bfv_R[i].SU   =   CV->s_u[m-1][i];
-			break;
-		    case -7: // periodic boundary conditions
-			bfv_L[i].SU   =   CV->s_u[m-1][i]; bfv_R[i].SU   =   CV->s_u[0][i];
-			bfv_L[i].SV   =   CV->s_v[m-1][i]; bfv_R[i].SV   =   CV->s_v[0][i];
-			bfv_L[i].SP   =   CV->s_p[m-1][i]; bfv_R[i].SP   =   CV->s_p[0][i];
-			bfv_L[i].SRHO = CV->s_rho[m-1][i]; bfv_R[i].SRHO = CV->s_rho[0][i];
-			break;
-		    case -24: // reflective + free boundary conditions
-			bfv_L[i].SU   =   CV->s_u[0][i];
-			break;
+			CV->s_u[j][-g]   =   CV->s_u[j][g-1]; CV->s_u[j][n-1+g]   =   CV->s_u[j][n-g];
+			CV->s_v[j][-g]   =   CV->s_v[j][g-1]; CV->s_v[j][n-1+g]   =   CV->s_v[j][n-g];
+			CV->s_p[j][-g]   =   CV->s_p[j][g-1]; CV->s_p[j][n-1+g]   =   CV->s_p[j][n-g];
+			CV->s_rho[j][-g] = CV->s_rho[j][g-1]; CV->s_rho[j][n-1+g] = CV->s_rho[j][n-g];
 		    }
-
+	    break;
+	case -7: // periodic boundary conditions in y-direction
+#pragma omp parallel for private(g)
 	    for(j = 0; j < m; ++j)
-		switch(bound_y)
+		for(g = 1; g <= N_GHOST; ++g)
 		    {
-		    case -2: case -4: case -24: // reflective OR free boundary conditions in y-direction
-			bfv_D[j].SU   =   CV->s_u[j][0];   bfv_U[j].SU   =   CV->s_u[j][n-1];
-			bfv_D[j].SV   =   CV->s_v[j][0];   bfv_U[j].SV   =   CV->s_v[j][n-1];
-			bfv_D[j].SP   =   CV->s_p[j][0];   bfv_U[j].SP   =   CV->s_p[j][n-1];
-			bfv_D[j].SRHO = CV->s_rho[j][0];   bfv_U[j].SRHO = CV->s_rho[j][n-1];
-			break;
-		    case -7: // periodic boundary conditions in y-direction
-			bfv_D[j].SU   =   CV->s_u[j][n-1]; bfv_U[j].SU   =   CV->s_u[j][0];
-			bfv_D[j].SV   =   CV->s_v[j][n-1]; bfv_U[j].SV   =   CV->s_v[j][0];
-			bfv_D[j].SP   =   CV->s_p[j][n-1]; bfv_U[j].SP   =   CV->s_p[j][0];
-			bfv_D[j].SRHO = CV->s_rho[j][n-1]; bfv_U[j].SRHO = CV->s_rho[j][0];
-			break;
+			CV->s_u[j][-g]   =   CV->s_u[j][n-g]; CV->s_u[j][n-1+g]   =   CV->s_u[j][g-1];
+			CV->s_v[j][-g]   =   CV->s_v[j][n-g]; CV->s_v[j][n-1+g]   =   CV->s_v[j][g-1];
+			CV->s_p[j][-g]   =   CV->s_p[j][n-g]; CV->s_p[j][n-1+g]   =   CV->s_p[j][g-1];
+			CV->s_rho[j][-g] = CV->s_rho[j][n-g]; CV->s_rho[j][n-1+g] = CV->s_rho[j][g-1];
 		    }
+	    break;
 	}
+}
+
+/**
+ * @brief This function fills the ghost grid cells in x-direction and apply the minmod limiter to the slope in the x-direction of two dimension.
+ * @param[in] m:          Number of the x-grids: n_x.
+ * @param[in] n:          Number of the y-grids: n_y.
+ * @param[in] nt:         Current plot time step for computing updates of conservative variables.
+ * @param[in,out] CV:     Structure of cell variable data.
+ * @param[in,out] bfv_L:  Fluid variables at left boundary, only kept for the initial boundary conditions.
+ * @param[in,out] bfv_R:  Fluid variables at right boundary, only kept for the initial boundary conditions.
+ * @param[in] find_bound_x: Whether the boundary conditions in x-direction have been found.
+ * @param[in] Slope:      Are there slopes? (true: 2nd-order / false: 1st-order)
+ * @param[in] t_c:        Time of current time step.
+ * @return find_bound_x:  Whether the boundary conditions in x-direction have been found.
+ */
+_Bool bound_cond_slope_limiter_x(const int m, const int n, const int nt, struct cell_var_stru * CV, struct b_f_var * bfv_L, struct b_f_var * bfv_R,
+				 _Bool find_bound_x, const _Bool Slope, const double t_c)
+{
+    int const bound_x = (int)(config[17]);// the boundary condition in x-direction
+    int i, n_thread;
+    switch (bound_x)
+	{
+	case -1: // initial boudary conditions
+	    if(!find_bound_x)
+		{
+		    printf("Initial boudary conditions in x direction at time %g .\n", t_c);
+		    for(i = 0; i < n; ++i)
+			{
+			    bfv_L[i].U   =   CV->U[0][i]; bfv_R[i].U   =   CV->U[m-1][i];
+			    bfv_L[i].V   =   CV->V[0][i]; bfv_R[i].V   =   CV->V[m-1][i];
+			    bfv_L[i].P   =   CV->P[0][i]; bfv_R[i].P   =   CV->P[m-1][i];
+			    bfv_L[i].RHO = CV->RHO[0][i]; bfv_R[i].RHO = CV->RHO[m-1][i];
+			}
+		}
+	    break;
+	case -2: // reflective boundary conditions
+	    if(!find_bound_x)
+		printf("Reflective boudary conditions in x direction.\n");
+	    break;
+	case -4: // free boundary conditions
+	    if(!find_bound_x)
+		printf("Free boudary conditions in x direction.\n");
+	    break;
+	case -7: // periodic boundary conditions
+	    if(!find_bound_x)
+		printf("Periodic boudary conditions in x direction.\n");
+	    break;
+	case -24: // reflective + free boundary conditions
+	    if(!find_bound_x)
+		printf("Reflective + Free boudary conditions in x direction.\n");
+	    break;
+	default:
+	    printf("No suitable boundary coditions in x direction!\n");
+	    return false;
+	}
+    n_thread = omp_tune_begin(TUNE_LIMITER_X);
+#pragma omp parallel num_threads(n_thread)
+    {
+	TL_BEGIN(tl);
+#pragma omp for schedule(runtime) nowait
+	for(i = 0; i < n; ++i)
+	    bound_cond_slope_limiter_x_rows(m, n, nt, CV, bfv_L, bfv_R, find_bound_x, Slope, i, i+1);
+	TL_END("limiter x rows", tl);
+    } // End of parallel region
+    omp_tune_end(TUNE_LIMITER_X);
+    if (Slope)
+	ghost_slope_x_trans(m, n, CV);
     return true;
 }
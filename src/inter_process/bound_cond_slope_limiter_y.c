@@ -1,129 +1,245 @@
 /**
  * @file  bound_cond_slope_limiter_y.c
  * @brief This is a function to set boundary conditions and use the slope limiter in y-direction of two dimension.
+ * @details The boundary conditions fill the N_GHOST ghost layers of the structured fields before the slope limiter of each column,
+ *          so that the slope limiter and the flux generator run over the interior without boundary branches.
  */
 #include <stdio.h>
 #include <stdbool.h>
 
 #include "../include/var_struc.h"
 #include "../include/inter_process.h"
+#include "../include/tools.h"
 
 
 /**
- * @brief This function apply the minmod limiter to the slope in the y-direction of two dimension.
+ * @brief This function copies the fluid variables of the grid cell [j][is] to the ghost grid cell [j][ig].
+ * @param[in,out] CV:  Structure of cell variable data at the current plot time step.
+ * @param[in] j:       x-index of the grid cells.
+ * @param[in] ig:      y-index of the ghost grid cell.
+ * @param[in] is:      y-index of the source grid cell.
+ * @param[in] sign_v:  -1.0 for reflective boundary, 1.0 otherwise.
+ */
+static inline void ghost_copy_y(struct cell_var_stru * CV, const int j, const int ig, const int is, const double sign_v)
+{
+    CV->RHO[j][ig] = CV->RHO[j][is];
+    CV->U[j][ig]   = CV->U[j][is];
+    CV->V[j][ig]   = sign_v*CV->V[j][is];
+    CV->P[j][ig]   = CV->P[j][is];
+}
+
+/**
+ * @brief This function copies the y-slopes of the grid cell [j][is] to the ghost grid cell [j][ig].
+ * @param[in,out] CV:  Structure of cell variable data.
+ * @param[in] j:       x-index of the grid cells.
+ * @param[in] ig:      y-index of the ghost grid cell.
+ * @param[in] is:      y-index of the source grid cell.
+ */
+static inline void ghost_slope_y(struct cell_var_stru * CV, const int j, const int ig, const int is)
+{
+    CV->t_rho[j][ig] = CV->t_rho[j][is];
+    CV->t_u[j][ig]   = CV->t_u[j][is];
+    CV->t_v[j][ig]   = CV->t_v[j][is];
+    CV->t_p[j][ig]   = CV->t_p[j][is];
+}
+
+/**
+ * @brief This function fills the ghost grid cells in y-direction and apply the minmod limiter to the slope in the y-direction
+ *        on the columns [j_0, j_1) of two dimension.
+ * @details The boundary conditions in y-direction should have been found by bound_cond_slope_limiter_y().
+ *          The work on a column only touches this column, so that the columns can be shared among threads or tasks in any order.
  * @param[in] m:          Number of the x-grids: n_x.
  * @param[in] n:          Number of the y-grids: n_y.
  * @param[in] nt:         Current plot time step for computing updates of conservative variables.
- * @param[in] CV:         Structure of cell variable data.
- * @param[in,out] bfv_L:  Fluid variables at left boundary.
- * @param[in,out] bfv_R:  Fluid variables at right boundary.
- * @param[in,out] bfv_D:  Fluid variables at downside boundary.
- * @param[in,out] bfv_U:  Fluid variables at upper boundary.
+ * @param[in,out] CV:     Structure of cell variable data.
+ * @param[in] bfv_D:      Fluid variables at downside boundary, only for the initial boundary conditions.
+ * @param[in] bfv_U:      Fluid variables at upper boundary, only for the initial boundary conditions.
  * @param[in] find_bound_y: Whether the boundary conditions in y-direction have been found.
  * @param[in] Slope:      Are there slopes? (true: 2nd-order / false: 1st-order)
- * @param[in] t_c:        Time of current time step.
- * @return find_bound_y:  Whether the boundary conditions in y-direction have been found.
+ * @param[in] j_0, j_1:   Range of the x-indices of the columns.
  */
-_Bool bound_cond_slope_limiter_y(const int m, const int n, const int nt, struct cell_var_stru * CV, struct b_f_var * bfv_L, struct b_f_var * bfv_R,
-				 struct b_f_var * bfv_D, struct b_f_var * bfv_U, _Bool find_bound_y, const _Bool Slope, const double t_c)
+void bound_cond_slope_limiter_y_cols(const int m, const int n, const int nt, struct cell_var_stru * CV,
+				     const struct b_f_var * bfv_D, const struct b_f_var * bfv_U,
+				     const _Bool find_bound_y, const _Bool Slope, const int j_0, const int j_1)
 {
-    int const bound_x = (int)(config[17]);// the boundary condition in x-direction
     int const bound_y = (int)(config[18]);// the boundary condition in y-direction
     double const h_y  = config[11];       // the length of the initial y-spatial grids
-    int i, j;
-    for(j = 0; j < m; ++j)
-	switch (bound_y)
-	    {
-	    case -1: // initial boudary conditions
-		if(find_bound_y)
-		    break;
-		else if (!j)
-		    printf("Initial boudary conditions in y direction at time %g .\n", t_c);
-		bfv_D[j].U   =   CV->U[j][0]; bfv_U[j].U   =   CV->U[j][n-1];
-		bfv_D[j].V   =   CV->V[j][0]; bfv_U[j].V   =   CV->V[j][n-1];
-		bfv_D[j].P   =   CV->P[j][0]; bfv_U[j].P   =   CV->P[j][n-1];
-		bfv_D[j].RHO = CV->RHO[j][0]; bfv_U[j].RHO = CV->RHO[j][n-1];
-		break;
-	    case -2: // reflective boundary conditions
-		if(!find_bound_y && !j)
-		    printf("Reflective boudary conditions in y direction.\n");
-		bfv_D[j].U   =   CV[nt].U[j][0]; bfv_U[j].U   =   CV[nt].U[j][n-1];
-		bfv_D[j].V   = - CV[nt].V[j][0]; bfv_U[j].V   = - CV[nt].V[j][n-1];
-		bfv_D[j].P   =   CV[nt].P[j][0]; bfv_U[j].P   =   CV[nt].P[j][n-1];
-		bfv_D[j].RHO = CV[nt].RHO[j][0]; bfv_U[j].RHO = CV[nt].RHO[j][n-1];
-		break;
-	    case -4: // free boundary conditions
-		if(!find_bound_y && !j)
-		    printf("Free boudary conditions in y direction.\n");
-		bfv_D[j].U   =   CV[nt].U[j][0]; bfv_U[j].U   =   CV[nt].U[j][n-1];
-		bfv_D[j].V   =   CV[nt].V[j][0]; bfv_U[j].V   =   CV[nt].V[j][n-1];
-		bfv_D[j].P   =   CV[nt].P[j][0]; bfv_U[j].P   =   CV[nt].P[j][n-1];
-		bfv_D[j].RHO = CV[nt].RHO[j][0]; bfv_U[j].RHO = CV[nt].RHO[j][n-1];
-		break;
-	    case -7: // periodic boundary conditions
-		if(!find_bound_y && !j)
-		    printf("Periodic boudary conditions in y direction.\n");
-		bfv_D[j].U   =   CV[nt].U[j][n-1]; bfv_U[j].U   =   CV[nt].U[j][0];
-		bfv_D[j].V   =   CV[nt].V[j][n-1]; bfv_U[j].V   =   CV[nt].V[j][0];
-		bfv_D[j].P   =   CV[nt].P[j][n-1]; bfv_U[j].P   =   CV[nt].P[j][0];
-		bfv_D[j].RHO = CV[nt].RHO[j][n-1]; bfv_U[j].RHO = CV[nt].RHO[j][0];
-		break;
-	    case -24: // reflective + free boundary conditions
-		if(!find_bound_y && !j)
-		    printf("Reflective + Free boudary conditions in y direction.\n");
-		bfv_D[j].U   =   CV[nt].U[j][0]; bfv_U[j].U   =   CV[nt].U[j][n-1];
-		bfv_D[j].V   = - CV[nt].V[j][0]; bfv_U[j].V   =   CV[nt].V[j][n-1];
-		bfv_D[j].P   =   CV[nt].P[j][0]; bfv_U[j].P   =   CV[nt].P[j][n-1];
-		bfv_D[j].RHO = CV[nt].RHO[j][0]; bfv_U[j].RHO = CV[nt].RHO[j][n-1];
-		break;
-	    default:
-		printf("No suitable boundary coditions in y direction!\n");
-		return false;
-	    }
-    if (Slope)
+    int j, g;
+    for(j = j_0; j < j_1; ++j)
 	{
-#pragma omp parallel for  schedule(dynamic, 8)
-	    for(j = 0; j < m; ++j)
+	    switch (bound_y)
 		{
-		    minmod_limiter(false, n, find_bound_y, CV->t_u[j],   CV[nt].U[j],   bfv_D[j].U,   bfv_U[j].U,   h_y);
-		    minmod_limiter(false, n, find_bound_y, CV->t_v[j],   CV[nt].V[j],   bfv_D[j].V,   bfv_U[j].V,   h_y);
-		    minmod_limiter(false, n, find_bound_y, CV->t_p[j],   CV[nt].P[j],   bfv_D[j].P,   bfv_U[j].P,   h_y);
-		    minmod_limiter(false, n, find_bound_y, CV->t_rho[j], CV[nt].RHO[j], bfv_D[j].RHO, bfv_U[j].RHO, h_y);
-		} // End of parallel region
+		case -1: // initial boudary conditions
+		    for(g = 1; g <= N_GHOST; ++g)
+			{
+			    CV[nt].U[j][-g]   = bfv_D[j].U;   CV[nt].U[j][n-1+g]   = bfv_U[j].U;
+			    CV[nt].V[j][-g]   = bfv_D[j].V;   CV[nt].V[j][n-1+g]   = bfv_U[j].V;
+			    CV[nt].P[j][-g]   = bfv_D[j].P;   CV[nt].P[j][n-1+g]   = bfv_U[j].P;
+			    CV[nt].RHO[j][-g] = bfv_D[j].RHO; CV[nt].RHO[j][n-1+g] = bfv_U[j].RHO;
+			}
+		    break;
+		case -2: // reflective boundary conditions
+		    for(g = 1; g <= N_GHOST; ++g)
+			{
+			    ghost_copy_y(CV+nt, j, -g,    g-1, -1.0);
+			    ghost_copy_y(CV+nt, j, n-1+g, n-g, -1.0);
+			}
+		    break;
+		case -4: // free boundary conditions
+		    for(g = 1; g <= N_GHOST; ++g)
+			{
+			    ghost_copy_y(CV+nt, j, -g,    0,   1.0);
+			    ghost_copy_y(CV+nt, j, n-1+g, n-1, 1.0);
+			}
+		    break;
+		case -7: // periodic boundary conditions
+		    for(g = 1; g <= N_GHOST; ++g)
+			{
+			    ghost_copy_y(CV+nt, j, -g,    n-g, 1.0);
+			    ghost_copy_y(CV+nt, j, n-1+g, g-1, 1.0);
+			}
+		    break;
+		case -24: // reflective + free boundary conditions
+		    for(g = 1; g <= N_GHOST; ++g)
+			{
+			    ghost_copy_y(CV+nt, j, -g,    g-1, -1.0);
+			    ghost_copy_y(CV+nt, j, n-1+g, n-1,  1.0);
+			}
+		    break;
+		}
+	    if (!Slope)
+		continue;
+	    minmod_limiter(false, n, find_bound_y, CV->t_u[j],   CV[nt].U[j],   CV[nt].U[j][-1],   CV[nt].U[j][n],   h_y);
+	    minmod_limiter(false, n, find_bound_y, CV->t_v[j],   CV[nt].V[j],   CV[nt].V[j][-1],   CV[nt].V[j][n],   h_y);
+	    minmod_limiter(false, n, find_bound_y, CV->t_p[j],   CV[nt].P[j],   CV[nt].P[j][-1],   CV[nt].P[j][n],   h_y);
+	    minmod_limiter(false, n, find_bound_y, CV->t_rho[j], CV[nt].RHO[j], CV[nt].RHO[j][-1], CV[nt].RHO[j][n], h_y);
 
-	    for(j = 0; j < m; ++j)
-		switch(bound_y)
+	    // y-slopes of the ghost grid cells in y-direction, the others stay zero.
+	    switch(bound_y)
+		{
+		case -2: // reflective boundary conditions
+		    for(g = 1; g <= N_GHOST; ++g)
+			{
+			    CV->t_v[j][-g] = CV->t_v[j][g-1]; CV->t_v[j][n-1+g] = CV->t_v[j][n-g];
+			}
+		    break;
+		case -7: // periodic boundary conditions
+		    for(g = 1; g <= N_GHOST; ++g)
+			{
+			    ghost_slope_y(CV, j, -g,    n-g);
+			    ghost_slope_y(CV, j, n-1+g, g-1);
+			}
+		    break;
+		case -24: // reflective + free boundary conditions
+		    for(g = 1; g <= N_GHOST; ++g)
+			CV->t_v[j][-g] = CV->t_v[j][g-1];
+		    break;
+		}
+	}
+}
+
+/**
+ * @brief This function fills the y-slopes of the ghost grid cells in x-direction for the transversal terms.
+ * @details It reads the y-slopes of the first and last N_GHOST columns, the others stay zero.
+ * @param[in] m:      Number of the x-grids: n_x.
+ * @param[in] n:      Number of the y-grids: n_y.
+ * @param[in,out] CV: Structure of cell variable data.
+ */
+void ghost_slope_y_trans(const int m, const int n, struct cell_var_stru * CV)
+{
+    int const bound_x = (int)(config[17]);// the boundary condition in x-direction
+    int i, g;
+    switch(bound_x)
+	{
+	case -2: case -4: case -24: // reflective OR free boundary conditions in x-direction
+#pragma omp parallel for private(g)
+	    for(i = 0; i < n; ++i)
+		for(g = 1; g <= N_GHOST; ++g)
 		    {
-		    case -2: // reflective boundary conditions
-			bfv_D[j].TV   =   CV->t_v[j][0];   bfv_U[j].TV   =   CV->t_v[j][n-1];
-			break;
-		    case -7: // periodic boundary conditions
-			bfv_D[j].TU   =   CV->t_u[j][n-1]; bfv_U[j].TU   =   CV->t_u[j][0];
-			bfv_D[j].TV   =   CV->t_v[j][n-1]; bfv_U[j].TV   =   CV->t_v[j][0];
-			bfv_D[j].TP   =   CV->t_p[j][n-1]; bfv_U[j].TP   =   CV->t_p[j][0];
-			bfv_D[j].TRHO = CV->t_rho[j][n-1]; bfv_U[j].TRHO = CV->t_rho[j][0];
-			break;
-		    case -24: // reflective + free boundary conditions
-			bfv_D[j].TV   =   CV->t_v[j][0];
-			break;
+			CV->t_u[-g][i]   =   CV->t_u[g-1][i]; CV->t_u[m-1+g][i]   =   CV->t_u[m-g][i];
+			CV->t_v[-g][i]   =   CV->t_v[g-1][i]; CV->t_v[m-1+g][i]   =   CV->t_v[m-g][i];
+			CV->t_p[-g][i]   =   CV->t_p[g-1][i]; CV->t_p[m-1+g][i]   =   CV->t_p[m-g][i];
+			CV->t_rho[-g][i] = CV->t_rho[g-1][i]; CV->t_rho[m-1+g][i] = CV->t_rho[m-g][i];
 		    }
-
+	    break;
+	case -7: // periodic boundary conditions in x-direction
+#pragma omp parallel for private(g)
 	    for(i = 0; i < n; ++i)
-		switch(bound_x)
+		for(g = 1; g <= N_GHOST; ++g)
 		    {
-		    case -2: case -4: case -24: // reflective OR free boundary conditions in x-direction
-			bfv_L[i].TU   =   CV->t_u[0][i];   bfv_R[i].TU   =   CV->t_u[m-1][i];
-			bfv_L[i].TV   =   CV->t_v[0][i];   bfv_R[i].TV   =   CV->t_v[m-1][i];
-			bfv_L[i].TP   =   CV->t_p[0][i];   bfv_R[i].TP   =   CV->t_p[m-1][i];
-			bfv_L[i].TRHO = CV->t_rho[0][i];   bfv_R[i].TRHO = CV->t_rho[m-1][i];
-			break;
-		    case -7: // periodic boundary conditions in x-direction
-			bfv_L[i].TU   =   CV->t_u[m-1][i]; bfv_R[i].TU   =   CV->t_u[0][i];
-			bfv_L[i].TV   =   CV->t_v[m-1][i]; bfv_R[i].TV   =   CV->t_v[0][i];
-			bfv_L[i].TP   =   CV->t_p[m-1][i]; bfv_R[i].TP   =   CV->t_p[0][i];
-			bfv_L[i].TRHO = CV->t_rho[m-1][i]; bfv_R[i].TRHO = CV->t_rho[0][i];
-			break;
+			CV->t_u[-g][i]   =   CV->t_u[m-g][i]; CV->t_u[m-1+g][i]   =   CV->t_u[g-1][i];
+			CV->t_v[-g][i]   =   CV->t_v[m-g][i]; CV->t_v[m-1+g][i]   =   CV->t_v[g-1][i];
+			CV->t_p[-g][i]   =   CV->t_p[m-g][i]; CV->t_p[m-1+g][i]   =   CV->t_p[g-1][i];
+			CV->t_rho[-g][i] = CV->t_rho[m-g][i]; CV->t_rho[m-1+g][i] = CV->t_rho[g-1][i];
 		    }
+	    break;
+	}
+}
+
+/**
+ * @brief This function fills the ghost grid cells in y-direction and apply the minmod limiter to the slope in the y-direction of two dimension.
+ * @param[in] m:          Number of the x-grids: n_x.
+ * @param[in] n:          Number of the y-grids: n_y.
+ * @param[in] nt:         Current plot time step for computing updates of conservative variables.
+ * @param[in,out] CV:     Structure of cell variable data.
+ * @param[in,out] bfv_D:  Fluid variables at downside boundary, only kept for the initial boundary conditions.
+ * @param[in,out] bfv_U:  Fluid variables at upper boundary, only kept for the initial boundary conditions.
+ * @param[in] find_bound_y: Whether the boundary conditions in y-direction have been found.
+ * @param[in] Slope:      Are there slopes? (true: 2nd-order / false: 1st-order)
+ * @param[in] t_c:        Time of current time step.
+ * @return find_bound_y:  Whether the boundary conditions in y-direction have been found.
+ */
+_Bool bound_cond_slope_limiter_y(const int m, const int n, const int nt, struct cell_var_stru * CV, struct b_f_var * bfv_D, struct b_f_var * bfv_U,
+				 _Bool find_bound_y, const _Bool Slope, const double t_c)
+{
+    int const bound_y = (int)(config[18]);// the boundary condition in y-direction
+    int j, n_thread;
+    switch (bound_y)
+	{
+	case -1: // initial boudary conditions
+	    if(!find_bound_y)
+		{
+		    printf("Initial boudary conditions in y direction at time %g .\n", t_c);
+		    for(j = 0; j < m; ++j)
+			{
+			    bfv_D[j].U   =   CV->U[j][0]; bfv_U[j].U   =   CV->U[j][n-1];
+			    bfv_D[j].V   =   CV->V[j][0]; bfv_U[j].V   =   CV->V[j][n-1];
+			    bfv_D[j].P   =   CV->P[j][0]; bfv_U[j].P   =   CV->P[j][n-1];
+			    bfv_D[j].RHO = CV->RHO[j][0]; bfv_U[j].RHO = CV->RHO[j][n-1];
+			}
+		}
+	    break;
+	case -2: // reflective boundary conditions
+	    if(!find_bound_y)
+		printf("Reflective boudary conditions in y direction.\n");
+	    break;
+	case -4: // free boundary conditions
+	    if(!find_bound_y)
+		printf("Free boudary conditions in y direction.\n");
+	    break;
+	case -7: // periodic boundary conditions
+	    if(!find_bound_y)
+		printf("Periodic boudary conditions in y direction.\n");
+	    break;
+	case -24: // reflective + free boundary conditions
+	    if(!find_bound_y)
+		printf("Reflective + Free boudary conditions in y direction.\n");
+	    break;
+	default:
+	    printf("No suitable boundary coditions in y direction!\n");
+	    return false;
 	}
+    n_thread = omp_tune_begin(TUNE_LIMITER_Y);
+#pragma omp parallel num_threads(n_thread)
+    {
+	TL_BEGIN(tl);
+#pragma omp for schedule(runtime) nowait
+	for(j = 0; j < m; ++j)
+	    bound_cond_slope_limiter_y_cols(m, n, nt, CV, bfv_D, bfv_U, find_bound_y, Slope, j, j+1);
+	TL_END("limiter y cols", tl);
+    } // End of parallel region
+    omp_tune_end(TUNE_LIMITER_Y);
+    if (Slope)
+	ghost_slope_y_trans(m, n, CV);
     return true;
 }
@@ -4,6 +4,7 @@
  */
 #include <stdio.h>
 #include <math.h>
+#include <stdbool.h>
 
 #include "../include/var_struc.h"
 
@@ -129,3 +130,108 @@ int star_dire_check(double *mid, double *dire, const int dim)
 
     return 0;
 }
+
+
+/**
+ * @brief This function checks the health monitor variables reduced over grid cells in one time step.
+ * @details The totals at the first call are taken as the reference of conservation.
+ *          The run is unhealthy if
+ *          - there is any NAN or INFinite variable;
+ *          - the minimum density or pressure is smaller than eps;
+ *          - the relative drift of total mass or energy exceeds 'config[39]' (> 0);
+ *          - the maximum Mach number exceeds 'config[43]' (> 0).
+ * @param[in] hv:   Structure pointer of health monitor variables.
+ * @param[in] step: Number of the time step.
+ * @param[in] time: Current time.
+ * @return    Whether the run is unhealthy and should be stopped.
+ */
+_Bool health_check(const struct health_var * hv, const int step, const double time)
+{
+    static struct health_var hv_0;
+    static _Bool hv_0_set = false;
+    double const eps    = config[4];
+    double const tol    = config[39];
+    double const Ma_lim = config[43];
+    double d_mass, d_ene;
+    _Bool sick = false;
+
+    if (!hv_0_set)
+	{
+	    hv_0 = *hv;
+	    hv_0_set = true;
+	}
+    d_mass = fabs(hv->mass - hv_0.mass) / fmax(fabs(hv_0.mass), eps);
+    d_ene  = fabs(hv->ene  - hv_0.ene)  / fmax(fabs(hv_0.ene),  eps);
+
+    if (hv->n_nan > 0)
+	{
+	    printf("\nNAN or INFinite error in %d cells", hv->n_nan);
+	    sick = true;
+	}
+    else if (hv->rho_min < eps || hv->p_min < eps)
+	{
+	    printf("\n<0.0 error of minimum density %g or pressure %g", hv->rho_min, hv->p_min);
+	    sick = true;
+	}
+    else if (tol > 0.0 && (d_mass > tol || d_ene > tol))
+	{
+	    printf("\nConservation error of relative drift in mass %g and energy %g", d_mass, d_ene);
+	    sick = true;
+	}
+    else if (Ma_lim > 0.0 && hv->Ma_max > Ma_lim)
+	{
+	    printf("\nMach number error of maximum %g", hv->Ma_max);
+	    sick = true;
+	}
+    if (sick)
+	{
+	    printf(" on [%d, %g] (t_n, time_c) - Health monitor\n", step, time);
+	    printf("  mass = %.10g, momentum = (%.10g, %.10g), energy = %.10g\n", hv->mass, hv->mom_x, hv->mom_y, hv->ene);
+	    printf("  rho_min = %g, p_min = %g, Ma_max = %g\n", hv->rho_min, hv->p_min, hv->Ma_max);
+	}
+    return sick;
+}
+
+
+/**
+ * @brief This function sums up the health monitor variables over the structured 2-D grid cells.
+ * @details It is a separate pass used only when the cell values are modified after the fused
+ *          reduction of the update loop, e.g. by the first-order fallback.
+ * @param[in]  m:  Number of the x-grids: n_x.
+ * @param[in]  n:  Number of the y-grids: n_y.
+ * @param[in]  CV: Structure of cell variable data at the current plot time step.
+ * @param[out] hv: Structure pointer of health monitor variables.
+ */
+void health_sum_2D_stru(const int m, const int n, const struct cell_var_stru * CV, struct health_var * hv)
+{
+    double const gamma = config[6];
+    double const h_x   = config[10];
+    double const h_y   = config[11];
+    double rho, u, v, p, Ma2_max = 0.0;
+    int i, j;
+
+    hv->mass = hv->mom_x = hv->mom_y = hv->ene = 0.0;
+    hv->rho_min = hv->p_min = INFINITY;
+    hv->n_nan = 0;
+    for(j = 0; j < m; ++j)
+	for(i = 0; i < n; ++i)
+	    {
+		rho = CV->RHO[j][i];
+		u   = CV->U[j][i];
+		v   = CV->V[j][i];
+		p   = CV->P[j][i];
+		hv->mass  += rho;
+		hv->mom_x += rho*u;
+		hv->mom_y += rho*v;
+		hv->ene   += rho*CV->E[j][i];
+		hv->rho_min = fmin(hv->rho_min, rho);
+		hv->p_min   = fmin(hv->p_min,   p);
+		Ma2_max     = fmax(Ma2_max, (u*u + v*v)*rho/(gamma*p));
+		hv->n_nan  += !isfinite(rho) || !isfinite(p) || !isfinite(u) || !isfinite(v);
+	    }
+    hv->mass  *= h_x*h_y;
+    hv->mom_x *= h_x*h_y;
+    hv->mom_y *= h_x*h_y;
+    hv->ene   *= h_x*h_y;
+    hv->Ma_max = sqrt(Ma2_max);
+}
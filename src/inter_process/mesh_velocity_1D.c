@@ -0,0 +1,120 @@
+/**
+ * @file  mesh_velocity_1D.c
+ * @brief There are strategies to compute the velocity of moving grid nodes of the 1-D ALE scheme.
+ * @details Every strategy has the type 'Mesh_Velocity_1D' and is chosen by 'config[45]'.
+ *          The fluxes of the ALE scheme are conservative for any grid velocity,
+ *          so the strategies only decide where the resolution goes.
+ */
+#include <math.h>
+
+#include "../include/var_struc.h"
+#include "../include/riemann_solver.h"
+#include "../include/inter_process.h"
+
+
+#define N_SMOOTH   2   //!< Number of smoothing passes on the monitor function.
+#define MONITOR_SAT 0.1 //!< Relative density change over an initial grid length at which the monitor function saturates.
+
+/**
+ * @brief This function keeps the grid nodes fixed (Eulerian strategy).
+ * @param[out] W: Velocity of the grid nodes x_{j-1/2}, j = 0,1,…,m.
+ * @param[in]  m: Number of the grids.
+ * @remark The other parameters are not used, see 'Mesh_Velocity_1D'.
+ */
+void mesh_velocity_EUL(double * W, const int m, const double tau, const double * X, const double * RHO,
+		       const double * RHO_L, const double * U_L, const double * P_L,
+		       const double * RHO_R, const double * U_R, const double * P_R)
+{
+    int j;
+    for(j = 0; j <= m; ++j)
+	W[j] = 0.0;
+}
+
+/**
+ * @brief This function moves the grid nodes with the velocity of the contact discontinuity (Lagrangian strategy).
+ * @details The velocity is the exact star velocity of the interfacial Riemann problem,
+ *          an acoustic estimate overshoots strong shocks and crushes the grid cells ahead of them.
+ *          The boundary nodes move as well.
+ * @param[out] W:     Velocity of the grid nodes x_{j-1/2}, j = 0,1,…,m.
+ * @param[in]  m:     Number of the grids.
+ * @param[in]  RHO_L: Density   on the left  side of the grid nodes at t_{n}.
+ * @param[in]  U_L:   Velocity  on the left  side of the grid nodes at t_{n}.
+ * @param[in]  P_L:   Pressure  on the left  side of the grid nodes at t_{n}.
+ * @param[in]  RHO_R: Density   on the right side of the grid nodes at t_{n}.
+ * @param[in]  U_R:   Velocity  on the right side of the grid nodes at t_{n}.
+ * @param[in]  P_R:   Pressure  on the right side of the grid nodes at t_{n}.
+ * @remark The other parameters are not used, see 'Mesh_Velocity_1D'.
+ */
+void mesh_velocity_LAG(double * W, const int m, const double tau, const double * X, const double * RHO,
+		       const double * RHO_L, const double * U_L, const double * P_L,
+		       const double * RHO_R, const double * U_R, const double * P_R)
+{
+    double const eps   = config[4];
+    double const gamma = config[6];
+    double c_L, c_R, p_star;
+    _Bool CRW[2];
+    int j;
+#ifdef _OPENMP
+#pragma omp parallel for private(c_L, c_R, p_star, CRW) if(m >= (int)config[48])
+#endif
+    for(j = 0; j <= m; ++j)
+	{
+	    c_L = sqrt(gamma * P_L[j] / RHO_L[j]);
+	    c_R = sqrt(gamma * P_R[j] / RHO_R[j]);
+	    Riemann_solver_exact_single(W+j, &p_star, gamma, U_L[j], U_R[j], P_L[j], P_R[j], c_L, c_R, CRW, eps, eps, 500);
+	}
+}
+
+/**
+ * @brief This function moves the grid nodes toward the equidistribution of a monitor function (adaptive strategy).
+ * @details The monitor function of the grid cell j is M_j = 1 + β*min(1, h*|ρ_x|/(ρ*MONITOR_SAT)),
+ *          where β is 'config[46]' and h is the initial grid length, so the grid cells at shocks and contact
+ *          discontinuities shrink to about h/(1+β). It is smoothed N_SMOOTH times by the weights (1,2,1)/4.
+ *          The target of the interior node x_{j-1/2} is (M_{j-1}*x_{j-3/2} + M_j*x_{j+1/2})/(M_{j-1} + M_j),
+ *          the node moves a fraction ω ('config[47]') of the way there in this time step,
+ *          and never more than a quarter of its adjacent grid cells. The boundary nodes are fixed.
+ * @param[out] W:   Velocity of the grid nodes x_{j-1/2}, j = 0,1,…,m.
+ * @param[in]  m:   Number of the grids.
+ * @param[in]  tau: The length of the time step.
+ * @param[in]  X:   Coordinate of the grid nodes at t_{n}.
+ * @param[in]  RHO: Density of the grid cells at t_{n}.
+ * @remark The other parameters are not used, see 'Mesh_Velocity_1D'.
+ */
+void mesh_velocity_adaptive(double * W, const int m, const double tau, const double * X, const double * RHO,
+			    const double * RHO_L, const double * U_L, const double * P_L,
+			    const double * RHO_R, const double * U_R, const double * P_R)
+{
+    double const h     = config[10];
+    double const beta  = config[46];
+    double const omega = config[47];
+    double g, M_prev, M_cur, x_t, dx_max;
+    int j, l, jL, jR;
+
+    // The monitor function of the grid cell j is stored in W[j+1].
+    for(j = 0; j < m; ++j)
+	{
+	    jL = j > 0   ? j-1 : j;
+	    jR = j < m-1 ? j+1 : j;
+	    g = h*fabs(RHO[jR] - RHO[jL]) / (fmin(RHO[jR], RHO[jL]) * 0.5*(X[jR+1] + X[jR] - X[jL+1] - X[jL]));
+	    W[j+1] = 1.0 + beta*fmin(1.0, g/MONITOR_SAT);
+	}
+    for(l = 0; l < N_SMOOTH; ++l)
+	{
+	    M_prev = W[1];
+	    for(j = 1; j <= m; ++j)
+		{
+		    M_cur = W[j];
+		    W[j] = 0.25*(M_prev + 2.0*M_cur + W[j < m ? j+1 : m]);
+		    M_prev = M_cur;
+		}
+	}
+    // W[j] holds M_{j-1} until the velocity of the node x_{j-1/2} overwrites it.
+    W[0] = 0.0;
+    for(j = 1; j < m; ++j)
+	{
+	    x_t    = (W[j]*X[j-1] + W[j+1]*X[j+1]) / (W[j] + W[j+1]);
+	    dx_max = 0.25*fmin(X[j] - X[j-1], X[j+1] - X[j]);
+	    W[j]   = fmax(-dx_max, fmin(dx_max, omega*(x_t - X[j]))) / tau;
+	}
+    W[m] = 0.0;
+}
@@ -35,7 +35,7 @@ void minmod_limiter(const _Bool NO_h, const int m, const _Bool i_f_var_get, doub
     va_start(ap, HL);
     double const alpha = config[41]; // the paramater in slope limiters.
     double s_L, s_R; // spatial derivatives in coordinate x (slopes) 
-    double h = HL, HR, * X;
+    double h = HL, HR = HL, * X = NULL;
     if (NO_h)
 	{
 	    HR = va_arg(ap, double);
@@ -43,6 +43,8 @@ void minmod_limiter(const _Bool NO_h, const int m, const _Bool i_f_var_get, doub
 	}
 #ifdef _OPENACC
 #pragma acc parallel loop private(s_L, s_R, h)
+#elif defined _OPENMP
+#pragma omp parallel for private(s_L, s_R) firstprivate(h) if(m >= (int)config[48])
 #endif
     for(int j = 0; j < m; ++j) // Reconstruct slopes
 	{ /*
@@ -7,26 +7,78 @@
 #include "../include/inter_process_unstruct.h"
 
 
-int fluid_var_update(struct flu_var * FV, struct cell_var * cv)
+/**
+ * @brief Convert the conservative variables of each grid cell into primitive variables once per time step.
+ * @details The primitive variables and the sound speed are cached in struct 'cv' for the reconstruction
+ *          and flux kernels, and copied into struct 'FV' for output.
+ *          The health monitor variables are reduced in the same loop if 'hv' is not NULL,
+ *          a grid cell failing the conversion keeps its old primitive variables and is counted in hv->n_nan.
+ * @param[out]    FV: Structure of fluid variable data array pointer.
+ * @param[in,out] cv: Structure of grid variable data in computational grid cells.
+ * @param[out]    hv: Structure pointer of health monitor variables (or NULL).
+ * @return Whether all primitive variables are valid.
+ */
+int fluid_var_update(struct flu_var * FV, struct cell_var * cv, struct health_var * hv)
 {
 	const int num_cell = (int)config[3];
-	struct i_f_var ifv;
+	struct i_f_var ifv = {.gamma = config[6]};
+	int retval = 1;
 
+	if (hv != NULL)
+		*hv = (struct health_var){.rho_min = INFINITY, .p_min = INFINITY};
 	for(int k = 0; k < num_cell; ++k)
 		{
 			cons_qty_copy_cv2ifv(&ifv, cv, k);			
 
 			if(cons2prim(&ifv) == 0)
 				{
-					fprintf(stderr, "Wrong in copying cons_var to prim_var!\n");
-					return 0;
+					if (retval)
+						fprintf(stderr, "Wrong in copying cons_var to prim_var on cell %d!\n", k);
+					retval = 0;
+					if (hv != NULL)
+						hv->n_nan++;
+					continue;
 				}
 			prim_var_copy_ifv2FV(&ifv, FV, k);
+			prim_var_copy_ifv2cv(&ifv, cv, k);
 
 			cons_qty_copy_ifv2cv(&ifv, cv, k);			
+
+			if (hv != NULL)
+				{
+					hv->mass  += cv->U_rho[k]*cv->vol[k];
+					hv->mom_x += cv->U_u[k]  *cv->vol[k];
+					hv->mom_y += cv->U_v[k]  *cv->vol[k];
+					hv->ene   += cv->U_e[k]  *cv->vol[k];
+					hv->rho_min = fmin(hv->rho_min, ifv.RHO);
+					hv->p_min   = fmin(hv->p_min,   ifv.P);
+					hv->Ma_max  = fmax(hv->Ma_max,  sqrt(ifv.U*ifv.U + ifv.V*ifv.V)/cv->c[k]);
+					hv->n_nan  += !isfinite(ifv.RHO) || !isfinite(ifv.P) || !isfinite(ifv.U) || !isfinite(ifv.V);
+				}
 		}
 
-	return 1;
+	return retval;
+}
+
+
+/**
+ * @brief These functions gather the conservative or primitive variables of grid cell c into 'ifv' for the face kernels,
+ *        from the packed per-cell state if it is allocated, otherwise from the separate arrays.
+ */
+static inline void cons_qty_gather(struct i_f_var * ifv, const struct cell_var * cv, const int c)
+{
+	if (cv->pack != NULL)
+		cons_qty_copy_pack2ifv(ifv, cv, c);
+	else
+		cons_qty_copy_cv2ifv(ifv, cv, c);
+}
+
+static inline void prim_var_gather(struct i_f_var * ifv, const struct cell_var * cv, const int c)
+{
+	if (cv->pack != NULL)
+		prim_var_copy_pack2ifv(ifv, cv, c);
+	else
+		prim_var_copy_cv2ifv(ifv, cv, c);
 }
 
 
@@ -34,40 +86,39 @@ static int order2_i_f_var_init(const struct cell_var * cv, struct i_f_var * ifv,
 {
 	const double n_x = ifv->n_x, n_y = ifv->n_y;
 	const double delta_x = ifv->delta_x, delta_y = ifv->delta_y;
+	double g[PK_NUM];
+
+	grad_copy_cv2arr(g, cv, k);
 
-	ifv->d_rho  =  cv->gradx_rho[k]*n_x + cv->grady_rho[k]*n_y;
-	ifv->d_e    =  cv->gradx_e[k]  *n_x + cv->grady_e[k]  *n_y;
-	ifv->d_u    =  cv->gradx_u[k]  *n_x + cv->grady_u[k]  *n_y;
-	ifv->d_v    =  cv->gradx_v[k]  *n_x + cv->grady_v[k]  *n_y;
-	ifv->t_rho  = -cv->gradx_rho[k]*n_y + cv->grady_rho[k]*n_x;
-	ifv->t_e    = -cv->gradx_e[k]  *n_y + cv->grady_e[k]  *n_x;
-	ifv->t_u    = -cv->gradx_u[k]  *n_y + cv->grady_u[k]  *n_x;
-	ifv->t_v    = -cv->gradx_v[k]  *n_y + cv->grady_v[k]  *n_x;
+	ifv->d_rho  =  g[PK_GX_RHO]*n_x + g[PK_GY_RHO]*n_y;
+	ifv->d_e    =  g[PK_GX_E]  *n_x + g[PK_GY_E]  *n_y;
+	ifv->d_u    =  g[PK_GX_U]  *n_x + g[PK_GY_U]  *n_y;
+	ifv->d_v    =  g[PK_GX_V]  *n_x + g[PK_GY_V]  *n_y;
+	ifv->t_rho  = -g[PK_GX_RHO]*n_y + g[PK_GY_RHO]*n_x;
+	ifv->t_e    = -g[PK_GX_E]  *n_y + g[PK_GY_E]  *n_x;
+	ifv->t_u    = -g[PK_GX_U]  *n_y + g[PK_GY_U]  *n_x;
+	ifv->t_v    = -g[PK_GX_V]  *n_y + g[PK_GY_V]  *n_x;
 #ifdef MULTIFLUID_BASICS
-	ifv->d_z_a  =  cv->gradx_z_a[k]*n_x + cv->grady_z_a[k]*n_y;
-	ifv->t_z_a  = -cv->gradx_z_a[k]*n_y + cv->grady_z_a[k]*n_x;
-	ifv->d_phi  =  cv->gradx_phi[k]*n_x + cv->grady_phi[k]*n_y;
-	ifv->t_phi  = -cv->gradx_phi[k]*n_y + cv->grady_phi[k]*n_x;
+	ifv->d_z_a  =  g[PK_GX_Z_A]*n_x + g[PK_GY_Z_A]*n_y;
+	ifv->t_z_a  = -g[PK_GX_Z_A]*n_y + g[PK_GY_Z_A]*n_x;
+	ifv->d_phi  =  g[PK_GX_PHI]*n_x + g[PK_GY_PHI]*n_y;
+	ifv->t_phi  = -g[PK_GX_PHI]*n_y + g[PK_GY_PHI]*n_x;
 #endif
 
-	if (cons2prim(ifv) == 0)
-		{
-			fprintf(stderr, "Error happens on primitive variable!\n");
-			return 0;
-		}
+	prim_var_gather(ifv, cv, k);
 
 	if ((int)config[31] == 0)
 		{
 			ifv->d_p = ifv->d_e;
 			ifv->t_p = ifv->t_e;
 
-			ifv->RHO += cv->gradx_rho[k]*delta_x + cv->grady_rho[k]*delta_y;
-			ifv->P   += cv->gradx_e[k]  *delta_x + cv->grady_e[k]  *delta_y;
-			ifv->U   += cv->gradx_u[k]  *delta_x + cv->grady_u[k]  *delta_y;
-			ifv->V   += cv->gradx_v[k]  *delta_x + cv->grady_v[k]  *delta_y;
+			ifv->RHO += g[PK_GX_RHO]*delta_x + g[PK_GY_RHO]*delta_y;
+			ifv->P   += g[PK_GX_E]  *delta_x + g[PK_GY_E]  *delta_y;
+			ifv->U   += g[PK_GX_U]  *delta_x + g[PK_GY_U]  *delta_y;
+			ifv->V   += g[PK_GX_V]  *delta_x + g[PK_GY_V]  *delta_y;
 #ifdef MULTIFLUID_BASICS
-			ifv->Z_a += cv->gradx_z_a[k]*delta_x + cv->grady_z_a[k]*delta_y;
-			ifv->PHI += cv->gradx_phi[k]*delta_x + cv->grady_phi[k]*delta_y;
+			ifv->Z_a += g[PK_GX_Z_A]*delta_x + g[PK_GY_Z_A]*delta_y;
+			ifv->PHI += g[PK_GX_PHI]*delta_x + g[PK_GY_PHI]*delta_y;
 			ifv->gamma = 1.0+1.0/(ifv->Z_a/(config[6]-1.0)+(1.0-ifv->Z_a)/(config[106]-1.0));
 #endif
 		}
@@ -78,15 +129,15 @@ static int order2_i_f_var_init(const struct cell_var * cv, struct i_f_var * ifv,
 			ifv->d_p = (ifv->d_e - 0.5*ifv->d_rho*ifv->U*ifv->U - ifv->RHO*ifv->U*ifv->d_u) * (ifv->gamma-1.0);	
 			ifv->d_p +=         (- 0.5*ifv->d_rho*ifv->V*ifv->V - ifv->RHO*ifv->V*ifv->d_v) * (ifv->gamma-1.0);
 
-			ifv->U_rho += cv->gradx_rho[k]*delta_x + cv->grady_rho[k]*delta_y;
-			ifv->U_e   += cv->gradx_e[k]  *delta_x + cv->grady_e[k]  *delta_y;
-			ifv->U_u   += cv->gradx_u[k]  *delta_x + cv->grady_u[k]  *delta_y;
-			ifv->U_v   += cv->gradx_v[k]  *delta_x + cv->grady_v[k]  *delta_y;
+			ifv->U_rho += g[PK_GX_RHO]*delta_x + g[PK_GY_RHO]*delta_y;
+			ifv->U_e   += g[PK_GX_E]  *delta_x + g[PK_GY_E]  *delta_y;
+			ifv->U_u   += g[PK_GX_U]  *delta_x + g[PK_GY_U]  *delta_y;
+			ifv->U_v   += g[PK_GX_V]  *delta_x + g[PK_GY_V]  *delta_y;
 #ifdef MULTIFLUID_BASICS
 			ifv->d_phi = (ifv->d_phi - ifv->PHI*ifv->d_rho)/ifv->RHO;
 			if ((_Bool)config[60])
 				ifv->d_gamma = (ifv->d_gamma - ifv->gamma*ifv->d_rho)/ifv->RHO;
-			ifv->U_phi += cv->gradx_phi[k]*delta_x + cv->grady_phi[k]*delta_y;
+			ifv->U_phi += g[PK_GX_PHI]*delta_x + g[PK_GY_PHI]*delta_y;
 #endif
 			if(cons2prim(ifv) == 0)
 				{
@@ -98,8 +149,8 @@ static int order2_i_f_var_init(const struct cell_var * cv, struct i_f_var * ifv,
 }
 
 
-static int order2_i_f_var0(struct i_f_var * ifv)
-{		
+static void order2_i_f_var0(const struct cell_var * cv, struct i_f_var * ifv, const int k)
+{
 	ifv->d_rho = 0.0;
 	ifv->d_e   = 0.0;
 	ifv->d_u   = 0.0;
@@ -117,41 +168,34 @@ static int order2_i_f_var0(struct i_f_var * ifv)
 	ifv->t_phi = 0.0;
 #endif
 
-	if(cons2prim(ifv) == 0)
-		{
-			fprintf(stderr, "Error happens on primitive variable!\n");
-			return 0;
-		}
-		
-	return 1;
+	prim_var_gather(ifv, cv, k);
 }
 
 	  
-int interface_var_init(const struct cell_var * cv, const struct mesh_var * mv,
-					   struct i_f_var * ifv, struct i_f_var * ifv_R,
-					   const int k, const int j, const int i, const double gauss)
+/**
+ * @brief This function initializes the variables on both sides of the j-th interface of the k-th grid cell.
+ * @param[in]  cv:       Structure of grid variable data in computational grid cells.
+ * @param[in]  mv:       Structure of meshing variable data.
+ * @param[out] ifv:      Structure of the variables on the inner side of the interface.
+ * @param[out] ifv_R:    Structure of the variables on the outer side of the interface.
+ * @param[in]  k, j:     Serial numbers of the grid cell and of its interface.
+ * @param[in]  cc:       Serial number of the adjacent cell, or the boundary condition indicator.
+ * @param[in]  p_p, p_n: Serial numbers of the end nodes of the interface.
+ * @param[in]  i:        The current time step.
+ * @param[in]  gauss:    Position of the Gauss point on the interface.
+ * @return  1 for a valid interface, -1 for a skipped boundary and 0 for an error.
+ */
+static int interface_var_calc(const struct cell_var * cv, const struct mesh_var * mv,
+							  struct i_f_var * ifv, struct i_f_var * ifv_R, const int k, const int j,
+							  const int cc, const int p_p, const int p_n, const int i, const double gauss)
 {
 	const int order = (int)config[9];
-	int **cc = cv->cell_cell;
-	int **cp = mv->cell_pt;
-
-	int p_p, p_n;
-	if(j == cp[k][0]-1) 
-		{
-			p_p=cp[k][1];
-			p_n=cp[k][j+1];
-		}				  
-	else
-		{
-			p_p=cp[k][j+2];
-			p_n=cp[k][j+1];
-		}
 
 	ifv->n_x = cv->n_x[k][j];
 	ifv->n_y = cv->n_y[k][j];
 	ifv->length = sqrt((mv->X[p_p] - mv->X[p_n])*(mv->X[p_p] - mv->X[p_n]) + (mv->Y[p_p] - mv->Y[p_n])*(mv->Y[p_p] - mv->Y[p_n]));
 
-	cons_qty_copy_cv2ifv(ifv, cv, k);
+	cons_qty_gather(ifv, cv, k);
    
 	if (order == 2)
 		{
@@ -168,11 +212,11 @@ int interface_var_init(const struct cell_var * cv, const struct mesh_var * mv,
 	ifv_R->n_y = ifv->n_y;
 	ifv_R->length = ifv->length;
 	
-	int cR; //cell_right	
-	if (cc[k][j] >= 0)
+	int cR = k; //cell_right
+	if (cc >= 0)
 		{
-			cR = cc[k][j];
-			cons_qty_copy_cv2ifv(ifv_R, cv, cR);			
+			cR = cc;
+			cons_qty_gather(ifv_R, cv, cR);			
 
 			if (order == 2)
 				{
@@ -185,53 +229,37 @@ int interface_var_init(const struct cell_var * cv, const struct mesh_var * mv,
 						}
 				}
 		}
-	else if (cc[k][j] == -1)//initial boundary condition.
+	else if (cc == -1)//initial boundary condition.
 		{
 			if (i > 1)
 				return -1;
-			cons_qty_copy_cv2ifv(ifv_R, cv, k);
+			cons_qty_gather(ifv_R, cv, k);
 
 			if (order == 2)
-				if(order2_i_f_var0(ifv_R) == 0)
-					{
-						fprintf(stderr, "Error happens on primitive variable!\n");
-						return 0;
-					}
+				order2_i_f_var0(cv, ifv_R, k);
 		}
-	else if (cc[k][j] == -3)//prescribed boundary condition.
+	else if (cc == -3)//prescribed boundary condition.
 		{
-			cons_qty_copy_cv2ifv(ifv_R, cv, k);			
+			cons_qty_gather(ifv_R, cv, k);			
 
 			if (order == 2)
-				if(order2_i_f_var0(ifv_R) == 0)
-					{
-						fprintf(stderr, "Error happens on primitive variable!\n");
-						return 0;
-					}
+				order2_i_f_var0(cv, ifv_R, k);
 		}		
-	else if (cc[k][j] != -2&&cc[k][j] != -4)
+	else if (cc != -2&&cc != -4)
 		{
-			printf("No suitable boundary!cc = %d!\n",cc[k][j]);
+			printf("No suitable boundary!cc = %d!\n",cc);
 			return 0;
 		}
 
 	if (order == 1)
 		{
-			if(cons2prim(ifv) == 0)
-				{
-					fprintf(stderr, "Error happens on primitive variable!\n");
-					return 0;
-				}
-			if (cc[k][j] != -2&&cc[k][j] != -4)
-				if(cons2prim(ifv_R) == 0)
-					{
-						fprintf(stderr, "Error happens on primitive variable!\n");
-						return 0;
-					}
+			prim_var_gather(ifv, cv, k);
+			if (cc != -2&&cc != -4)
+				prim_var_gather(ifv_R, cv, cR);
 		}
 
 	double u_R, v_R;
-	if (cc[k][j] == -2)//reflecting boundary condition.
+	if (cc == -2)//reflecting boundary condition.
 		{
 			*ifv_R = *ifv;
 			u_R =  ifv_R->U*ifv_R->n_x + ifv_R->V*ifv_R->n_y;
@@ -240,12 +268,81 @@ int interface_var_init(const struct cell_var * cv, const struct mesh_var * mv,
 			ifv_R->U = u_R*ifv_R->n_x - v_R*ifv_R->n_y;
 			ifv_R->V = u_R*ifv_R->n_y + v_R*ifv_R->n_x;
 		}
-	else if (cc[k][j] == -4)//symmetry boundary condition.
+	else if (cc == -4)//symmetry boundary condition.
 		*ifv_R = *ifv;
 
 	return 1;
 }
 
+/**
+ * @brief This function initializes the variables on both sides of the j-th interface of the k-th grid cell,
+ *        the adjacent cell and the end nodes are found through 'cv->cell_cell[][]' and 'mv->cell_pt[][]'.
+ * @param[in]  cv:    Structure of grid variable data in computational grid cells.
+ * @param[in]  mv:    Structure of meshing variable data.
+ * @param[out] ifv:   Structure of the variables on the inner side of the interface.
+ * @param[out] ifv_R: Structure of the variables on the outer side of the interface.
+ * @param[in]  k, j:  Serial numbers of the grid cell and of its interface.
+ * @param[in]  i:     The current time step.
+ * @param[in]  gauss: Position of the Gauss point on the interface.
+ * @return  1 for a valid interface, -1 for a skipped boundary and 0 for an error.
+ */
+int interface_var_init(const struct cell_var * cv, const struct mesh_var * mv,
+					   struct i_f_var * ifv, struct i_f_var * ifv_R,
+					   const int k, const int j, const int i, const double gauss)
+{
+	int **cp = mv->cell_pt;
+
+	int p_p, p_n;
+	if(j == cp[k][0]-1) 
+		{
+			p_p=cp[k][1];
+			p_n=cp[k][j+1];
+		}				  
+	else
+		{
+			p_p=cp[k][j+2];
+			p_n=cp[k][j+1];
+		}
+
+	return interface_var_calc(cv, mv, ifv, ifv_R, k, j, cv->cell_cell[k][j], p_p, p_n, i, gauss);
+}
+
+/**
+ * @brief This function initializes the variables on both sides of the j-th interface of the grid cell (x, y)
+ *        on a logically structured quadrilateral mesh (mv->n_x > 0).
+ * @details The cell k = y*n_x + x has the nodes k+y, k+y+1, k+y+n_x+2 and k+y+n_x+1 counterclockwise,
+ *          and its interfaces j = 0, 1, 2, 3 face the cells below, right, above and left,
+ *          so that 'cv->cell_cell[][]' is read only for the boundary condition on the outermost interfaces.
+ * @param[in]  cv:    Structure of grid variable data in computational grid cells.
+ * @param[in]  mv:    Structure of meshing variable data.
+ * @param[out] ifv:   Structure of the variables on the inner side of the interface.
+ * @param[out] ifv_R: Structure of the variables on the outer side of the interface.
+ * @param[in]  x, y:  (i, j)-indices of the grid cell.
+ * @param[in]  j:     Serial number of the interface.
+ * @param[in]  i:     The current time step.
+ * @param[in]  gauss: Position of the Gauss point on the interface.
+ * @return  1 for a valid interface, -1 for a skipped boundary and 0 for an error.
+ */
+int interface_var_init_ij(const struct cell_var * cv, const struct mesh_var * mv,
+						  struct i_f_var * ifv, struct i_f_var * ifv_R,
+						  const int x, const int y, const int j, const int i, const double gauss)
+{
+	const int n_x = mv->n_x, n_y = mv->n_y;
+	const int k = y*n_x + x, p = k + y;
+	const int pt[5] = {p, p+1, p+n_x+2, p+n_x+1, p};
+
+	int cR;
+	switch (j)
+		{
+		case 0:  cR = y > 0     ? k-n_x : cv->cell_cell[k][j]; break;
+		case 1:  cR = x < n_x-1 ? k+1   : cv->cell_cell[k][j]; break;
+		case 2:  cR = y < n_y-1 ? k+n_x : cv->cell_cell[k][j]; break;
+		default: cR = x > 0     ? k-1   : cv->cell_cell[k][j]; break;
+		}
+
+	return interface_var_calc(cv, mv, ifv, ifv_R, k, j, cR, pt[j+1], pt[j], i, gauss);
+}
+
 
 double tau_calc(const struct cell_var * cv, const struct mesh_var * mv)
 {
@@ -253,7 +350,9 @@ double tau_calc(const struct cell_var * cv, const struct mesh_var * mv)
 	if (CFL < 0.0)
 		return -CFL;
 	const int num_cell = (int)config[3];
+	const int order = (int)config[9];
 	int ** cp = mv->cell_pt;
+	int ** cc = cv->cell_cell;
 	
 	double tau = config[1];
 	struct i_f_var ifv, ifv_R;
@@ -278,8 +377,16 @@ double tau_calc(const struct cell_var * cv, const struct mesh_var * mv)
 						{
 							qn = ifv.U*ifv.n_x + ifv.V*ifv.n_y; 
 							qn_R = ifv_R.U*ifv_R.n_x + ifv_R.V*ifv_R.n_y;
-							c = sqrt(ifv.gamma * ifv.P / ifv.RHO);
-							c_R = sqrt(ifv_R.gamma * ifv_R.P / ifv_R.RHO);
+							if (order == 1) // cell-centred values, use the cached sound speeds.
+								{
+									c   = cv->c[k];
+									c_R = cv->c[cc[k][j] >= 0 ? cc[k][j] : k];
+								}
+							else
+								{
+									c = sqrt(ifv.gamma * ifv.P / ifv.RHO);
+									c_R = sqrt(ifv_R.gamma * ifv_R.P / ifv_R.RHO);
+								}
 							lambda_max = fmax(c+fabs(qn), c_R+fabs(qn_R));
 							cum += 0.5*lambda_max * ifv.length;
 						}
@@ -4,6 +4,7 @@
 #include <math.h>
 
 
+#include "../include_cii/mem.h"
 #include "../include/var_struc.h"
 #include "../include/tools.h"
 #include "../include/inter_process_unstruct.h"
@@ -26,42 +27,23 @@
 #define CV_INIT_MEM(v, n)						\
     do {								\
 	if(i_or_f)							\
-	    {								\
-		cv->v = (double *)calloc(n, sizeof(double));		\
-		if(cv->v == NULL)					\
-		    {							\
-			fprintf(stderr, "Not enough memory in DOUBLE cell center variable initialize!\n"); \
-			exit(5);					\
-		    }							\
-	    }								\
+	    cv->v = (double *)CALLOC_TAG(n, sizeof(double), "fields");	\
 	else								\
-	    {								\
-		free(cv->v);						\
-		cv->v = NULL;						\
-	    }								\
+	    FREE(cv->v);						\
     } while (0)								\
 	
 #define CP_INIT_MEM(v, n)						\
     do {								\
 	if(i_or_f)							\
 	    {								\
-		cv->v = (double **)malloc((n) * sizeof(double *));	\
-		if(cv->v == NULL)					\
-		    {							\
-			fprintf(stderr, "Not enough memory in DOUBLE cell point variable initialize!\n"); \
-			exit(5);					\
-		    }							\
+		cv->v = (double **)ALLOC_TAG((n) * sizeof(double *), "per-edge arrays"); \
 		init_mem(cv->v, n, mv->cell_pt);			\
 	    }								\
 	else								\
 	    {								\
 		for(int j = 0; j < (n); j++)				\
-		    {							\
-			free(cv->v[j]);					\
-			cv->v[j] = NULL;				\
-		    }							\
-		free(cv->v);						\
-		cv->v = NULL;						\
+		    FREE(cv->v[j]);					\
+		FREE(cv->v);						\
 	    }								\
     } while (0)								\
 
@@ -69,23 +51,14 @@
     do {								\
 	if(i_or_f)							\
 	    {								\
-		cv->v = (int **)malloc((n) * sizeof(int *));		\
-		if(cv->v == NULL)					\
-		    {							\
-			fprintf(stderr, "Not enough memory in INT cell point variable initialize!\n"); \
-			exit(5);					\
-		    }							\
+		cv->v = (int **)ALLOC_TAG((n) * sizeof(int *), "per-edge arrays"); \
 		init_mem_int(cv->v, n, mv->cell_pt);			\
 	    }								\
  	else								\
 	    {								\
 		for(int j = 0; j < (n); j++)				\
-		    {							\
-			free(cv->v[j]);					\
-			cv->v[j] = NULL;				\
-		    }							\
-		free(cv->v);						\
-		cv->v = NULL;						\
+		    FREE(cv->v[j]);					\
+		FREE(cv->v);						\
 	    }								\
     } while (0)								\
 
@@ -125,6 +98,15 @@ void cell_mem_init_free(struct cell_var * cv, const struct mesh_var * mv, struct
 	FV_RESET_MEM(V,    num_cell_ghost);
 	FV_RESET_MEM(RHO,  num_cell_ghost);
 	FV_RESET_MEM(P,    num_cell_ghost);
+	CV_INIT_MEM(RHO,   num_cell_ghost);
+	CV_INIT_MEM(U,     num_cell_ghost);
+	CV_INIT_MEM(V,     num_cell_ghost);
+	CV_INIT_MEM(P,     num_cell_ghost);
+	CV_INIT_MEM(c,     num_cell_ghost);
+	if (i_or_f)
+		cv->pack = NULL;
+	if ((_Bool)config[54])
+		CV_INIT_MEM(pack, (num_cell_ghost + CELL_PACK_W-1) / CELL_PACK_W * CELL_PACK_W * PK_NUM);
 
 	CP_INIT_MEM(U_p,   num_cell_ghost);
 	CP_INIT_MEM(V_p,   num_cell_ghost);
@@ -143,7 +125,7 @@ void cell_mem_init_free(struct cell_var * cv, const struct mesh_var * mv, struct
 			CV_INIT_MEM(grady_v,   num_cell_ghost);
 		}
 
-#ifdef MULTIPHASE_BASICS
+#ifdef MULTIFLUID_BASICS
 	CP_INIT_MEM(F_phi, num_cell);
 	CV_INIT_MEM(U_phi, num_cell_ghost);
 	FV_RESET_MEM(PHI, num_cell_ghost);
@@ -153,6 +135,9 @@ void cell_mem_init_free(struct cell_var * cv, const struct mesh_var * mv, struct
 	CP_INIT_MEM(F_gamma, num_cell);
 	CV_INIT_MEM(U_gamma, num_cell_ghost);
 	FV_RESET_MEM(gamma, num_cell_ghost);
+	CV_INIT_MEM(Z_a,   num_cell_ghost);
+	CV_INIT_MEM(PHI,   num_cell_ghost);
+	CV_INIT_MEM(gamma, num_cell_ghost);
 	CP_INIT_MEM(PHI_p, num_cell);
 	CP_INIT_MEM(Z_a_p, num_cell);
 	CP_INIT_MEM(gamma_p, num_cell);
@@ -170,7 +155,7 @@ void cell_mem_init_free(struct cell_var * cv, const struct mesh_var * mv, struct
 	    }
 #endif
 
-#ifdef MULTIPHASE_BASICS
+#ifdef MULTIFLUID_BASICS
 	CP_INIT_MEM(P_star, num_cell);
 	CP_INIT_MEM(U_qt_star, num_cell);
 	CP_INIT_MEM(V_qt_star, num_cell);
@@ -219,6 +204,9 @@ void vol_comp(const struct cell_var * cv, const struct mesh_var * mv)
 
 	int p_p, p_n;
 
+#ifdef _OPENMP
+#pragma omp parallel for private(p_p, p_n) schedule(static)
+#endif
 	for(int k = 0; k < num_cell; k++)
 	    {			
 		cv->vol[k] = 0.0;
@@ -242,6 +230,7 @@ void vol_comp(const struct cell_var * cv, const struct mesh_var * mv)
 
 /**
  * @brief Determine interfacial normal directions ('cv->n_x/n_y[][]') and relationship between cells ('cv->cell_cell[][]').
+ * @details The relationship between cells is copied from 'mv->cell_cell[][]' searched while the mesh is built.
  * @param[in,out] cv: Structure of grid variable data in computational grid cells.
  * @param[in]     mv: Structure of meshing variable data.
  */
@@ -250,12 +239,12 @@ void cell_rel(const struct cell_var * cv, const struct mesh_var * mv)
 	const int num_cell = mv->num_ghost + (int)config[3];
 
 	int **cp = mv->cell_pt;
-	int p_p, p_n, p2_p, p2_n;
-
-	int cell_rec, n_border;
-	int i, l, ts;
+	int p_p, p_n;
 	double length;
 
+#ifdef _OPENMP
+#pragma omp parallel for private(p_p, p_n, length) schedule(static)
+#endif
 	for(int k = 0; k < num_cell; k++)
 	    { 						
 		for(int j = 0; j < cp[k][0]; j++)
@@ -274,70 +263,8 @@ void cell_rel(const struct cell_var * cv, const struct mesh_var * mv)
 			cv->n_x[k][j] = (mv->Y[p_p] - mv->Y[p_n]) / length;
 			cv->n_y[k][j] = (mv->X[p_n] - mv->X[p_p]) / length;
 			//Inner normal 
-
-			cell_rec = 0;
-			ts = 1;
-			while (ts <= MAX(num_cell-k-1, k))
-			    {
-				// seek in two side
-				i = k + ts;
-				if (ts > 0)
-				    ts = -ts;
-				else
-				    ts = -ts + 1;
-				if (i < 0 || i >= num_cell)
-				    continue;
-
-				for(l = 0; l < cp[i][0]; l++)
-				    {
-					if(l == cp[i][0]-1) 
-					    {
-						p2_p = cp[i][1];
-						p2_n = cp[i][l+1];
-					    }				  
-					else
-					    {
-						p2_p = cp[i][l+2];
-						p2_n = cp[i][l+1];
-					    }
-					if((p_p == p2_n) && (p2_p == p_n))
-					    {
-						cv->cell_cell[k][j] = i;
-						cell_rec = 1;
-						break;
-					    }
-				    }
-				if (cell_rec)
-				    break;
-			    }
-
-			if (cell_rec)
-			    continue;
-
-			for(l = 1, n_border = -1; l <= mv->num_border[0]; l++)
-			    {
-				n_border += mv->num_border[l] + 1; 
-				for(i = n_border-mv->num_border[l]; i < n_border; i++)
-				    {				
-					p2_p = mv->border_pt[i+1];
-					p2_n = mv->border_pt[i];
-					if((p_p == p2_p && p_n == p2_n) || (p_p == p2_n && p_n == p2_p))
-					    {
-						cv->cell_cell[k][j] = mv->border_cond[i];
-						cell_rec = 1;
-						break;
-					    }
-				    }							
-				if (cell_rec)
-				    break;
-			    }
-
-			if(!cell_rec && k < (int)config[3])
-			    {
-				fprintf(stderr, "Ther are some wrong cell relationships!\n");
-				exit(2);
-			    }
-		    }							
+		    }
+		memcpy(cv->cell_cell[k], mv->cell_cell[k], cp[k][0] * sizeof(int));
 	    }
 }
 
@@ -355,6 +282,9 @@ void cell_centroid(const struct cell_var * cv, const struct mesh_var * mv)
 
 	double S, S_tri;
 
+#ifdef _OPENMP
+#pragma omp parallel for private(S, S_tri) schedule(static)
+#endif
 	for(int k = 0; k < num_cell; ++k)
 	    {
 		S = 0.0;
@@ -12,6 +12,8 @@ int cons_qty_update_corr_ave_P(struct cell_var * cv, const struct mesh_var * mv,
 	const int num_cell = (int)config[3];
 	const int order = (int)config[9];
 	int ** cp = mv->cell_pt;
+	const int n_x = mv->n_x;
+	const int pt[5] = {0, 1, n_x+2, n_x+1, 0}; // implicit nodes of a cell on a logically structured mesh (n_x > 0)
 
 	double U_u_a = 0.0, U_v_a = 0.0;
 	int p_p, p_n;
@@ -52,9 +54,14 @@ int cons_qty_update_corr_ave_P(struct cell_var * cv, const struct mesh_var * mv,
 			else if (order == 2)
 				Z_a = FV->Z_a[k]-0.5*tau*(cv->U_u[k]*cv->gradx_z_a[k]+cv->U_v[k]*cv->grady_z_a[k])/cv->U_rho[k];
 #endif
-			for(j = 0; j < cp[k][0]; j++)
+			for(j = 0; j < (n_x > 0 ? 4 : cp[k][0]); j++)
 				{
-					if(j == cp[k][0]-1) 
+					if (n_x > 0)
+						{
+							p_p = k + k/n_x + pt[j+1];
+							p_n = k + k/n_x + pt[j];
+						}
+					else if(j == cp[k][0]-1) 
 						{
 							p_p=cp[k][1];
 							p_n=cp[k][j+1];
@@ -2,6 +2,7 @@
 #include <math.h>
 
 #include "../include/var_struc.h"
+#include "../include/inter_process_unstruct.h"
 
 
 
@@ -44,6 +45,35 @@ void prim_var_copy_ifv2FV(const struct i_f_var * ifv, const struct flu_var * FV,
 #endif
 }
 
+void prim_var_copy_ifv2cv(const struct i_f_var * ifv, const struct cell_var * cv, const int c)
+{
+	cv->RHO[c] = ifv->RHO;
+	cv->P[c]   = ifv->P;
+	cv->U[c]   = ifv->U;
+	cv->V[c]   = ifv->V;
+	cv->c[c]   = sqrt(ifv->gamma * ifv->P / ifv->RHO);
+#ifdef MULTIFLUID_BASICS
+	cv->PHI[c]   = ifv->PHI;
+	cv->Z_a[c]   = ifv->Z_a;
+	cv->gamma[c] = ifv->gamma;
+#endif
+}
+
+void prim_var_copy_cv2ifv(struct i_f_var * ifv, const struct cell_var * cv, const int c)
+{
+	ifv->RHO = cv->RHO[c];
+	ifv->P   = cv->P[c];
+	ifv->U   = cv->U[c];
+	ifv->V   = cv->V[c];
+#ifdef MULTIFLUID_BASICS
+	ifv->PHI   = cv->PHI[c];
+	ifv->Z_a   = cv->Z_a[c];
+	ifv->gamma = cv->gamma[c];
+#else
+	ifv->gamma = config[6];
+#endif
+}
+
 void flux_copy_ifv2cv(const struct i_f_var * ifv, const struct cell_var * cv, const int k, const int j)
 {
 	cv->F_rho[k][j] = ifv->F_rho;
@@ -121,3 +151,145 @@ void flux_add_ifv2cv(const struct i_f_var * ifv, const struct cell_var * cv, con
 	cv->gamma_p[k][j] = 0.5*(cv->gamma_p[k][j] + ifv->gamma);
 #endif
 }
+
+
+/**
+ * @brief This function scatters the variables of grid cell c from the separate arrays of 'cv' into the packed per-cell state.
+ * @details The gradients are packed only for the second-order scheme.
+ * @param[in,out] cv: Structure of grid variable data in computational grid cells.
+ * @param[in]     c:  Serial number of the grid cell.
+ */
+void cell_pack_scatter(const struct cell_var * cv, const int c)
+{
+	CELL_PACK(cv, c, PK_U_RHO) = cv->U_rho[c];
+	CELL_PACK(cv, c, PK_U_E)   = cv->U_e[c];
+	CELL_PACK(cv, c, PK_U_U)   = cv->U_u[c];
+	CELL_PACK(cv, c, PK_U_V)   = cv->U_v[c];
+	CELL_PACK(cv, c, PK_RHO)   = cv->RHO[c];
+	CELL_PACK(cv, c, PK_P)     = cv->P[c];
+	CELL_PACK(cv, c, PK_U)     = cv->U[c];
+	CELL_PACK(cv, c, PK_V)     = cv->V[c];
+#ifdef MULTIFLUID_BASICS
+	CELL_PACK(cv, c, PK_U_PHI)   = cv->U_phi[c];
+	CELL_PACK(cv, c, PK_U_E_A)   = cv->U_e_a[c];
+	CELL_PACK(cv, c, PK_U_GAMMA) = cv->U_gamma[c];
+	CELL_PACK(cv, c, PK_PHI)     = cv->PHI[c];
+	CELL_PACK(cv, c, PK_Z_A)     = cv->Z_a[c];
+	CELL_PACK(cv, c, PK_GAMMA)   = cv->gamma[c];
+#endif
+	if ((int)config[9] < 2)
+		return;
+	CELL_PACK(cv, c, PK_GX_RHO) = cv->gradx_rho[c];
+	CELL_PACK(cv, c, PK_GX_E)   = cv->gradx_e[c];
+	CELL_PACK(cv, c, PK_GX_U)   = cv->gradx_u[c];
+	CELL_PACK(cv, c, PK_GX_V)   = cv->gradx_v[c];
+	CELL_PACK(cv, c, PK_GY_RHO) = cv->grady_rho[c];
+	CELL_PACK(cv, c, PK_GY_E)   = cv->grady_e[c];
+	CELL_PACK(cv, c, PK_GY_U)   = cv->grady_u[c];
+	CELL_PACK(cv, c, PK_GY_V)   = cv->grady_v[c];
+#ifdef MULTIFLUID_BASICS
+	CELL_PACK(cv, c, PK_GX_Z_A) = cv->gradx_z_a[c];
+	CELL_PACK(cv, c, PK_GY_Z_A) = cv->grady_z_a[c];
+	CELL_PACK(cv, c, PK_GX_PHI) = cv->gradx_phi[c];
+	CELL_PACK(cv, c, PK_GY_PHI) = cv->grady_phi[c];
+#endif
+}
+
+/**
+ * @brief This function refreshes the packed per-cell state of all grid cells (including ghost cells) from the separate arrays.
+ * @details It is called once per time step after the primitive variables, the gradients and the boundary conditions are updated.
+ * @param[in,out] cv: Structure of grid variable data in computational grid cells.
+ * @param[in]     mv: Structure of meshing variable data.
+ */
+void cell_pack_update(const struct cell_var * cv, const struct mesh_var * mv)
+{
+	const int num_cell_ghost = mv->num_ghost + (int)config[3];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1024)
+#endif
+	for(int k = 0; k < num_cell_ghost; k++)
+		cell_pack_scatter(cv, k);
+}
+
+/**
+ * @brief This function gathers the conservative variables of grid cell c from the packed per-cell state into 'ifv'.
+ * @param[out] ifv: Structure of the interfacial variables.
+ * @param[in]  cv:  Structure of grid variable data in computational grid cells, with the packed state allocated.
+ * @param[in]  c:   Serial number of the grid cell.
+ */
+void cons_qty_copy_pack2ifv(struct i_f_var * ifv, const struct cell_var * cv, const int c)
+{
+	ifv->U_rho = CELL_PACK(cv, c, PK_U_RHO);
+	ifv->U_e   = CELL_PACK(cv, c, PK_U_E);
+	ifv->U_u   = CELL_PACK(cv, c, PK_U_U);
+	ifv->U_v   = CELL_PACK(cv, c, PK_U_V);
+#ifdef MULTIFLUID_BASICS
+	ifv->U_phi   = CELL_PACK(cv, c, PK_U_PHI);
+	ifv->U_e_a   = CELL_PACK(cv, c, PK_U_E_A);
+	ifv->U_gamma = CELL_PACK(cv, c, PK_U_GAMMA);
+#endif
+}
+
+/**
+ * @brief This function gathers the primitive variables of grid cell c from the packed per-cell state into 'ifv'.
+ * @param[out] ifv: Structure of the interfacial variables, the ratio of specific heats is also set.
+ * @param[in]  cv:  Structure of grid variable data in computational grid cells, with the packed state allocated.
+ * @param[in]  c:   Serial number of the grid cell.
+ */
+void prim_var_copy_pack2ifv(struct i_f_var * ifv, const struct cell_var * cv, const int c)
+{
+	ifv->RHO = CELL_PACK(cv, c, PK_RHO);
+	ifv->P   = CELL_PACK(cv, c, PK_P);
+	ifv->U   = CELL_PACK(cv, c, PK_U);
+	ifv->V   = CELL_PACK(cv, c, PK_V);
+#ifdef MULTIFLUID_BASICS
+	ifv->PHI   = CELL_PACK(cv, c, PK_PHI);
+	ifv->Z_a   = CELL_PACK(cv, c, PK_Z_A);
+	ifv->gamma = CELL_PACK(cv, c, PK_GAMMA);
+#else
+	ifv->gamma = config[6];
+#endif
+}
+
+/**
+ * @brief This function gathers the gradients of grid cell c into the array 'grad' indexed by 'enum cell_pack_var',
+ *        from the packed per-cell state if it is allocated, otherwise from the separate arrays.
+ * @param[out] grad: Gradients of the grid cell, only the entries PK_GX_* and PK_GY_* are set.
+ * @param[in]  cv:   Structure of grid variable data in computational grid cells.
+ * @param[in]  c:    Serial number of the grid cell.
+ */
+void grad_copy_cv2arr(double grad[PK_NUM], const struct cell_var * cv, const int c)
+{
+	if (cv->pack != NULL)
+		{
+			grad[PK_GX_RHO] = CELL_PACK(cv, c, PK_GX_RHO);
+			grad[PK_GX_E]   = CELL_PACK(cv, c, PK_GX_E);
+			grad[PK_GX_U]   = CELL_PACK(cv, c, PK_GX_U);
+			grad[PK_GX_V]   = CELL_PACK(cv, c, PK_GX_V);
+			grad[PK_GY_RHO] = CELL_PACK(cv, c, PK_GY_RHO);
+			grad[PK_GY_E]   = CELL_PACK(cv, c, PK_GY_E);
+			grad[PK_GY_U]   = CELL_PACK(cv, c, PK_GY_U);
+			grad[PK_GY_V]   = CELL_PACK(cv, c, PK_GY_V);
+#ifdef MULTIFLUID_BASICS
+			grad[PK_GX_Z_A] = CELL_PACK(cv, c, PK_GX_Z_A);
+			grad[PK_GY_Z_A] = CELL_PACK(cv, c, PK_GY_Z_A);
+			grad[PK_GX_PHI] = CELL_PACK(cv, c, PK_GX_PHI);
+			grad[PK_GY_PHI] = CELL_PACK(cv, c, PK_GY_PHI);
+#endif
+			return;
+		}
+	grad[PK_GX_RHO] = cv->gradx_rho[c];
+	grad[PK_GX_E]   = cv->gradx_e[c];
+	grad[PK_GX_U]   = cv->gradx_u[c];
+	grad[PK_GX_V]   = cv->gradx_v[c];
+	grad[PK_GY_RHO] = cv->grady_rho[c];
+	grad[PK_GY_E]   = cv->grady_e[c];
+	grad[PK_GY_U]   = cv->grady_u[c];
+	grad[PK_GY_V]   = cv->grady_v[c];
+#ifdef MULTIFLUID_BASICS
+	grad[PK_GX_Z_A] = cv->gradx_z_a[c];
+	grad[PK_GY_Z_A] = cv->grady_z_a[c];
+	grad[PK_GX_PHI] = cv->gradx_phi[c];
+	grad[PK_GY_PHI] = cv->grady_phi[c];
+#endif
+}
@@ -46,6 +46,11 @@ void period_ghost(struct cell_var * cv, const struct mesh_var * mv, struct flu_v
 			FV_COPY(P);
 			FV_COPY(U);
 			FV_COPY(V);
+			CV_COPY(RHO);
+			CV_COPY(P);
+			CV_COPY(U);
+			CV_COPY(V);
+			CV_COPY(c);
 			if (order > 1)
 			    {
 				CV_COPY(gradx_rho);
@@ -63,6 +68,9 @@ void period_ghost(struct cell_var * cv, const struct mesh_var * mv, struct flu_v
 			CV_COPY(U_gamma);
 			FV_COPY(PHI);
 			FV_COPY(gamma);
+			CV_COPY(PHI);
+			CV_COPY(Z_a);
+			CV_COPY(gamma);
 			if (order > 1)
 			    {
 				CV_COPY(gradx_phi);
@@ -128,4 +136,5 @@ void period_cell_modify(struct mesh_var * mv)
 		}
 	
 	mv->bc = period_ghost;
+	mv->n_x = 0; // the cells are no longer in (i, j) order.
 }
@@ -0,0 +1,204 @@
+/**
+ * @file  mesh_cache.c
+ * @brief This is a set of functions which write or read the binary cache file of an unstructured mesh file '*.msh'.
+ * @details The cache file '*.msh.cache' holds the topology, the boundaries, the coordinates of grid nodes and
+ *          the relationships between grid cells of the mesh, so that the parsing of '*.msh' file and the search
+ *          of adjacent cells are skipped on later runs as long as the hash of the mesh file matches.
+ *          The data are stored in the native byte order, a cache file from another machine is rejected by its hash or sizes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "../include_cii/mem.h"
+#include "../include/var_struc.h"
+#include "../include/tools.h"
+#include "../include/meshing.h"
+
+
+//! Identifier and version of the mesh cache file.
+#define MESH_CACHE_MAGIC "HYMSHC01"
+
+//! Header of the mesh cache file.
+struct mesh_cache_head {
+	char magic[8];
+	unsigned long long hash; //!< FNV-1a hash of the mesh file.
+	int num_cell;            //!< 'config[3]' when the cache is written.
+	int num_ghost, num_pt;
+	int num_border[10];
+	int len_bp; //!< Length of 'border_pt'.
+};
+
+
+/**
+ * @brief This function computes the 64-bit FNV-1a hash of the contents of a file.
+ * @param[in] fp: The pointer to the input file.
+ * @return \b hash: FNV-1a hash of the file.
+ */
+unsigned long long mesh_file_hash(FILE * fp)
+{
+	unsigned long long hash = HASH_FNV1A_INIT;
+	unsigned char buf[65536];
+	size_t n;
+
+	rewind(fp);
+	while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+		hash = hash_fnv1a(hash, buf, n);
+	rewind(fp);
+	return hash;
+}
+
+
+/**
+ * @brief This function writes the mesh data and the relationships between grid cells into a cache file.
+ * @details A failure of writing only gives a warning, the computation goes on without the cache.
+ * @param[in] add:  Address of the cache file.
+ * @param[in] hash: FNV-1a hash of the mesh file.
+ * @param[in] mv:   Structure of meshing variable data.
+ */
+void mesh_cache_write(const char * add, const unsigned long long hash, const struct mesh_var * mv)
+{
+	const int num_cell = mv->num_ghost + (int)config[3];
+	int ** cp = mv->cell_pt;
+	struct mesh_cache_head head = {0};
+	int k, ok = 1;
+
+	memcpy(head.magic, MESH_CACHE_MAGIC, sizeof(head.magic));
+	head.hash      = hash;
+	head.num_cell  = (int)config[3];
+	head.num_ghost = mv->num_ghost;
+	head.num_pt    = mv->num_pt;
+	memcpy(head.num_border, mv->num_border, sizeof(head.num_border));
+	for(k = 1; k <= mv->num_border[0]; k++)
+		head.len_bp += mv->num_border[k] + 1;
+
+	FILE * fp;
+	if ((fp = fopen(add, "wb")) == NULL)
+		{
+			printf("Warning: Can't write the mesh cache file(%s)!\n", add);
+			return;
+		}
+	ok = ok && fwrite(&head, sizeof(head), 1, fp) == 1;
+	ok = ok && fwrite(mv->X, sizeof(double), mv->num_pt, fp) == (size_t)mv->num_pt;
+	ok = ok && fwrite(mv->Y, sizeof(double), mv->num_pt, fp) == (size_t)mv->num_pt;
+	for(k = 0; ok && k < num_cell; k++)
+		ok = fwrite(cp[k], sizeof(int), cp[k][0]+1, fp) == (size_t)(cp[k][0]+1);
+	ok = ok && fwrite(mv->cell_type, sizeof(int), num_cell, fp) == (size_t)num_cell;
+	ok = ok && fwrite(mv->border_pt, sizeof(int), head.len_bp, fp) == (size_t)head.len_bp;
+	ok = ok && fwrite(mv->border_cond, sizeof(int), head.len_bp-1, fp) == (size_t)(head.len_bp-1);
+	for(k = 0; ok && k < num_cell; k++)
+		ok = fwrite(mv->cell_cell[k], sizeof(int), cp[k][0], fp) == (size_t)cp[k][0];
+	if (fclose(fp) != 0 || !ok)
+		{
+			printf("Warning: Fail to write the mesh cache file(%s)!\n", add);
+			remove(add);
+		}
+}
+
+
+/**
+ * @brief This function checks whether the header of a cache file matches the mesh file and is consistent.
+ * @param[in] head: Header of the cache file.
+ * @param[in] hash: FNV-1a hash of the mesh file.
+ * @return Whether the header is valid.
+ */
+static int mesh_cache_head_check(const struct mesh_cache_head * head, const unsigned long long hash)
+{
+	int len_bp = 0;
+
+	if (memcmp(head->magic, MESH_CACHE_MAGIC, sizeof(head->magic)) != 0 || head->hash != hash
+	    || head->num_cell != (int)config[3] || head->num_ghost < 0 || head->num_ghost > INT_MAX - head->num_cell
+	    || head->num_pt <= 0 || head->len_bp < 2
+	    || head->num_border[0] < 0 || head->num_border[0] >= (int)(sizeof(head->num_border)/sizeof(head->num_border[0])))
+		return 0;
+	for(int k = 1; k <= head->num_border[0]; k++)
+		{
+			if (head->num_border[k] < 0 || head->num_border[k] >= head->len_bp)
+				return 0;
+			len_bp += head->num_border[k] + 1;
+		}
+	return len_bp == head->len_bp;
+}
+
+/**
+ * @brief This function reads the mesh data and the relationships between grid cells from a cache file.
+ * @param[in]  add:  Address of the cache file.
+ * @param[in]  hash: FNV-1a hash of the mesh file.
+ * @param[out] mv:   Structure of meshing variable data.
+ * @return It returns 1 if the cache file matches the mesh file and has been read, otherwise returns 0.
+ */
+int mesh_cache_read(const char * add, const unsigned long long hash, struct mesh_var * mv)
+{
+	struct mesh_cache_head head;
+	int k, j, num_cell, len_cp = 0, ok = 1;
+
+	FILE * fp;
+	if ((fp = fopen(add, "rb")) == NULL)
+		return 0;
+	if (fread(&head, sizeof(head), 1, fp) != 1 || !mesh_cache_head_check(&head, hash))
+		{
+			printf("The mesh cache file(%s) is out of date!\n", add);
+			fclose(fp);
+			return 0;
+		}
+	num_cell = head.num_ghost + head.num_cell;
+
+	mv->num_ghost = head.num_ghost;
+	mv->num_pt    = head.num_pt;
+	memcpy(mv->num_border, head.num_border, sizeof(head.num_border));
+	mv->X           = (double*)ALLOC(mv->num_pt * sizeof(double));
+	mv->Y           = (double*)ALLOC(mv->num_pt * sizeof(double));
+	mv->cell_pt     = (int**)  CALLOC(num_cell, sizeof(int *));
+	mv->cell_cell   = (int**)  CALLOC(num_cell, sizeof(int *));
+	mv->cell_type   = (int*)   ALLOC(num_cell * sizeof(int));
+	mv->border_pt   = (int*)   ALLOC(head.len_bp * sizeof(int));
+	mv->border_cond = (int*)   ALLOC((head.len_bp-1) * sizeof(int));
+
+	ok = ok && fread(mv->X, sizeof(double), mv->num_pt, fp) == (size_t)mv->num_pt;
+	ok = ok && fread(mv->Y, sizeof(double), mv->num_pt, fp) == (size_t)mv->num_pt;
+	for(k = 0; ok && k < num_cell; k++)
+		{
+			ok = fread(&len_cp, sizeof(int), 1, fp) == 1 && len_cp > 0 && len_cp <= mv->num_pt;
+			if (!ok)
+				break;
+			mv->cell_pt[k]    = (int*)ALLOC((len_cp+1) * sizeof(int));
+			mv->cell_pt[k][0] = len_cp;
+			ok = fread(mv->cell_pt[k]+1, sizeof(int), len_cp, fp) == (size_t)len_cp;
+			for(j = 1; ok && j <= len_cp; j++)
+				ok = mv->cell_pt[k][j] >= 0 && mv->cell_pt[k][j] < mv->num_pt;
+		}
+	ok = ok && fread(mv->cell_type, sizeof(int), num_cell, fp) == (size_t)num_cell;
+	ok = ok && fread(mv->border_pt, sizeof(int), head.len_bp, fp) == (size_t)head.len_bp;
+	for(j = 0; ok && j < head.len_bp; j++)
+		ok = mv->border_pt[j] >= 0 && mv->border_pt[j] < mv->num_pt;
+	ok = ok && fread(mv->border_cond, sizeof(int), head.len_bp-1, fp) == (size_t)(head.len_bp-1);
+	for(k = 0; ok && k < num_cell; k++)
+		{
+			mv->cell_cell[k] = (int*)ALLOC(mv->cell_pt[k][0] * sizeof(int));
+			ok = fread(mv->cell_cell[k], sizeof(int), mv->cell_pt[k][0], fp) == (size_t)mv->cell_pt[k][0];
+			for(j = 0; ok && j < mv->cell_pt[k][0]; j++)
+				ok = mv->cell_cell[k][j] < num_cell;
+		}
+	fclose(fp);
+	if (ok)
+		return 1;
+
+	printf("The mesh cache file(%s) is broken!\n", add);
+	for(k = 0; k < num_cell; k++)
+		{
+			FREE(mv->cell_pt[k]);
+			FREE(mv->cell_cell[k]);
+		}
+	FREE(mv->cell_pt);
+	FREE(mv->cell_cell);
+	FREE(mv->cell_type);
+	FREE(mv->border_pt);
+	FREE(mv->border_cond);
+	FREE(mv->X);
+	FREE(mv->Y);
+	*mv = (struct mesh_var){0};
+	mv->num_border[0] = 1;
+	return 0;
+}
@@ -11,6 +11,7 @@
 #include "../include_cii/mem.h"
 #include "../include/var_struc.h"
 #include "../include/file_io.h"
+#include "../include/tools.h"
 #include "../include/meshing.h"
 
 
@@ -27,6 +28,9 @@ static void cell_pt_clockwise(const struct mesh_var * mv)
 
 	double X_max;
 	int n_max, tmp;
+#ifdef _OPENMP
+#pragma omp parallel for private(p_p, p, p_n, X_max, n_max, tmp) schedule(static)
+#endif
 	for(int k = 0; k < num_cell; k++)
 	    {
 		n_max = 1;
@@ -66,6 +70,168 @@ static void cell_pt_clockwise(const struct mesh_var * mv)
 }
 
 
+/**
+ * @brief This function checks whether the i-th grid cell shares the interface from node p_n to node p_p.
+ * @param[in] cp:  Serial number of each grid node on a grid cell.
+ * @param[in] i:   Serial number of the grid cell to be checked.
+ * @param[in] p_p, p_n: Serial numbers of the end nodes of the interface.
+ * @return Whether the i-th grid cell is adjacent to the interface.
+ */
+static inline int cell_face_match(int ** cp, const int i, const int p_p, const int p_n)
+{
+	int p2_p, p2_n;
+	for(int l = 0; l < cp[i][0]; l++)
+	    {
+		if(l == cp[i][0]-1) 
+		    {
+			p2_p = cp[i][1];
+			p2_n = cp[i][l+1];
+		    }				  
+		else
+		    {
+			p2_p = cp[i][l+2];
+			p2_n = cp[i][l+1];
+		    }
+		if((p_p == p2_n) && (p2_p == p_n))
+		    return 1;
+	    }
+	return 0;
+}
+
+/**
+ * @brief This function seeks the interface from node p_n to node p_p on the connected boundaries.
+ * @param[in]  mv:  Structure of meshing variable data.
+ * @param[in]  p_p, p_n: Serial numbers of the end nodes of the interface.
+ * @param[out] cond: Boundary condition indicator of the interface.
+ * @return Whether the interface lies on the boundaries.
+ */
+static int cell_face_border(const struct mesh_var * mv, const int p_p, const int p_n, int * cond)
+{
+	int p2_p, p2_n;
+	for(int l = 1, n_border = -1; l <= mv->num_border[0]; l++)
+	    {
+		n_border += mv->num_border[l] + 1; 
+		for(int i = n_border-mv->num_border[l]; i < n_border; i++)
+		    {				
+			p2_p = mv->border_pt[i+1];
+			p2_n = mv->border_pt[i];
+			if((p_p == p2_p && p_n == p2_n) || (p_p == p2_n && p_n == p2_p))
+			    {
+				*cond = mv->border_cond[i];
+				return 1;
+			    }
+		    }							
+	    }
+	return 0;
+}
+
+/**
+ * @brief This function searches the adjacent cell (or the boundary condition) of each interface of the grid cells
+ *        and stores it in 'mv->cell_cell[][]'.
+ * @details On a logically structured quadrilateral mesh (mv->n_x > 0) the j-th interface of a cell is first matched with
+ *          its (i, j)-neighbour (below, right, above, left) or with the boundaries, otherwise the search runs over all grid cells
+ *          outward from the cell, which is O(N^2) in the worst case.
+ *          If any cell or interface is not in the (i, j) order, mv->n_x is reset to 0 so that the solvers do not use the implicit connectivity.
+ *          So the search is done once while the mesh is built and cached together with the mesh file '*.msh'.
+ * @param[in,out] mv: Structure of meshing variable data.
+ */
+static void cell_rel_search(struct mesh_var * mv)
+{
+	const int num_cell = mv->num_ghost + (int)config[3];
+	const int n_x = mv->n_x;
+
+	int **cp = mv->cell_pt;
+	int p_p, p_n;
+
+	int cell_rec, nb[4], ij, ij_mesh = n_x > 0, rel_err = 0;
+	int i, ts;
+
+	mv->cell_cell = (int**)ALLOC(num_cell * sizeof(int *));
+	for(int k = 0; k < num_cell; k++)
+	    mv->cell_cell[k] = (int*)ALLOC(cp[k][0] * sizeof(int));
+
+#ifdef _OPENMP
+#pragma omp parallel for private(p_p, p_n, cell_rec, nb, ij, i, ts) reduction(&&:ij_mesh) reduction(||:rel_err) schedule(dynamic, 64)
+#endif
+	for(int k = 0; k < num_cell; k++)
+	    { 						
+		ij = n_x > 0 && cp[k][0] == 4 && cp[k][1] == k + k/n_x && cp[k][2] == cp[k][1] + 1
+		     && cp[k][3] == cp[k][1] + n_x + 2 && cp[k][4] == cp[k][1] + n_x + 1;
+		if (ij) // (i, j)-neighbours on a logically structured mesh
+		    {
+			nb[0] = k >= n_x                ? k-n_x : -1;
+			nb[1] = k%n_x < n_x-1           ? k+1   : -1;
+			nb[2] = k < num_cell-n_x        ? k+n_x : -1;
+			nb[3] = k%n_x > 0               ? k-1   : -1;
+		    }
+		else if (n_x > 0)
+		    ij_mesh = 0;
+		for(int j = 0; j < cp[k][0]; j++)
+		    {
+			if(j == cp[k][0]-1) 
+			    {
+				p_p = cp[k][1];
+				p_n = cp[k][j+1];
+			    }				  
+			else
+			    {
+				p_p = cp[k][j+2];
+				p_n = cp[k][j+1];
+			    }
+
+			if (ij && nb[j] >= 0 && cell_face_match(cp, nb[j], p_p, p_n))
+			    {
+				mv->cell_cell[k][j] = nb[j];
+				continue;
+			    }
+			else if (ij && nb[j] < 0 && cell_face_border(mv, p_p, p_n, mv->cell_cell[k]+j))
+			    continue;
+			else if (ij)
+			    ij_mesh = 0; // fall back to the general search
+
+			cell_rec = 0;
+			ts = 1;
+			while (ts <= MAX(num_cell-k-1, k))
+			    {
+				// seek in two side
+				i = k + ts;
+				if (ts > 0)
+				    ts = -ts;
+				else
+				    ts = -ts + 1;
+				if (i < 0 || i >= num_cell)
+				    continue;
+
+				if (cell_face_match(cp, i, p_p, p_n))
+				    {
+					mv->cell_cell[k][j] = i;
+					cell_rec = 1;
+					break;
+				    }
+			    }
+
+			if (cell_rec)
+			    continue;
+
+			cell_rec = cell_face_border(mv, p_p, p_n, mv->cell_cell[k]+j);
+
+			if(!cell_rec && k < (int)config[3])
+			    rel_err = 1; // reported once after the parallel loop
+		    }							
+	    }
+
+	if (rel_err)
+	    {
+		fprintf(stderr, "Ther are some wrong cell relationships!\n");
+		exit(2);
+	    }
+	if (n_x > 0 && !ij_mesh)
+	    {
+		printf("The cells are not in (i, j) order, the general unstructured kernels are used!\n");
+		mv->n_x = 0;
+	    }
+}
+
 struct mesh_var mesh_init(const char *example, const char *mesh_name)
 {
 	struct mesh_var mv = {0};
@@ -78,13 +244,32 @@ struct mesh_var mesh_init(const char *example, const char *mesh_name)
 	strcat(add, mesh_name);
 	strcat(add, ".msh");
 
+	char add_cache[FILENAME_MAX];
+	strcpy(add_cache, add);
+	strcat(add_cache, ".cache");
+
 	FILE * fp;
+	unsigned long long hash;
+	double tic = wall_time();
 	if ((fp = fopen(add, "r")) != NULL)
 		{
+		    hash = mesh_file_hash(fp);
+		    if(mesh_cache_read(add_cache, hash, &mv))
+			{
+			    fclose(fp);
+			    printf("Mesh cache(%s.msh.cache) has been read!\n", mesh_name);
+			    wall_time_stage("reading the mesh cache", tic);
+			    return mv;
+			}
 		    if(msh_read(fp, &mv))
 			{									
 			    fclose(fp);
 			    printf("Mesh file(%s.msh) has been read!\n", mesh_name);
+			    tic = wall_time_stage("reading the mesh file", tic);
+			    cell_rel_search(&mv);
+			    tic = wall_time_stage("searching the cell relationships", tic);
+			    mesh_cache_write(add_cache, hash, &mv);
+			    wall_time_stage("writing the mesh cache", tic);
 			    return mv;
 			}
 			else
@@ -114,7 +299,11 @@ struct mesh_var mesh_init(const char *example, const char *mesh_name)
 		exit(2);
 	    }
 
+	tic = wall_time_stage("generating the mesh", tic);
 	cell_pt_clockwise(&mv);
+	tic = wall_time_stage("ordering the cell nodes clockwise", tic);
+	cell_rel_search(&mv);
+	wall_time_stage("searching the cell relationships", tic);
 	return mv;
 }
 
@@ -122,6 +311,10 @@ void mesh_mem_free(struct mesh_var * mv)
 {
 	const int num_cell = (int)config[3];
 
+	if (mv->cell_cell != NULL)
+	    for(int k = 0; k < mv->num_ghost + num_cell; k++)
+		FREE(mv->cell_cell[k]);
+	FREE(mv->cell_cell);
 	for(int k = 0; k < num_cell; k++)
 	    FREE(mv->cell_pt[k]);
 	FREE(mv->cell_pt);
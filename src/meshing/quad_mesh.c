@@ -32,6 +32,8 @@ static int quad_mesh_init(struct mesh_var * mv, int n_x_add, int n_y_add)
 	if (num_cell > (int)config[3])
 		printf("There are %d ghost cell!\n", mv->num_ghost = num_cell - (int)config[3]);
 
+	mv->n_x = n_x;
+	mv->n_y = n_y;
 	mv->num_pt = (n_x+1)*(n_y+1);
 	mv->X = (double*)ALLOC(mv->num_pt * sizeof(double));
 	mv->Y = (double*)ALLOC(mv->num_pt * sizeof(double));
@@ -89,21 +91,16 @@ static int quad_mesh_init(struct mesh_var * mv, int n_x_add, int n_y_add)
 	return 1;
 
  return_NULL:
-	free(mv->X);
-	mv->X = NULL;
-	free(mv->Y);
-	mv->Y = NULL;	
-	free(mv->border_pt);
-	mv->border_pt = NULL;
+	FREE(mv->X);
+	FREE(mv->Y);
+	FREE(mv->border_pt);
 	for(k = 0; k < num_cell; k++)
 		{
 			if (mv->cell_pt[k] == NULL)
 				break;
-			free(mv->cell_pt[k]);
-			mv->cell_pt[k] = NULL;
+			FREE(mv->cell_pt[k]);
 		}
-	free(mv->cell_pt);
-	mv->cell_pt = NULL;	
+	FREE(mv->cell_pt);
 	exit(5);	
 }
 
@@ -250,10 +247,8 @@ static int quad_border_cond
 	return 1;
 
  return_NULL:
-	free(mv->border_cond);
-	mv->border_cond = NULL;	
-	free(mv->period_cell);
-	mv->period_cell = NULL;
+	FREE(mv->border_cond);
+	FREE(mv->period_cell);
 	exit(5);	
 }
 
@@ -419,8 +414,7 @@ static int quad_border_normal_velocity
 	return 1;
 
  return_NULL:
-	free(mv->normal_v);
-	mv->normal_v = NULL;
+	FREE(mv->normal_v);
 	exit(5);	
 }
 
@@ -8,6 +8,7 @@
 
 #include "../include/var_struc.h"
 #include "../include/riemann_solver.h"
+#include "../include/tools.h"
 
 
 /**
@@ -52,6 +53,7 @@ void linear_GRP_solver_Edir(double * D, double * U, const struct i_f_var *ifv_L,
   double shk_spd, zeta = (gamma-1.0)/(gamma+1.0), zts = zeta*zeta;
   double g_rho, g_u, g_p, f;
   double speed_L, speed_R;
+  double pow_c;
 
   c_L = sqrt(gamma * p_L / rho_L);
   c_R = sqrt(gamma * p_R / rho_R);
@@ -191,13 +193,14 @@ void linear_GRP_solver_Edir(double * D, double * U, const struct i_f_var *ifv_L,
       U[2] = pow(U[2], gamma/(gamma-1.0));
       U[0] = gamma*U[2]/U[1]/U[1];
 
-      D[1] = 0.5*(pow(U[1]/c_L, 0.5/zeta)*(1.0+zeta) + pow(U[1]/c_L, (1.0+zeta)/zeta)*zeta)/(0.5+zeta);
+      pow_c = pow(U[1]/c_L, 0.5/zeta);
+      D[1] = 0.5*(pow_c*(1.0+zeta) + pow_lin_fast(U[1]/c_L, (1.0+zeta)/zeta, pow_c, 2, 1)*zeta)/(0.5+zeta);
       D[1] = D[1] * (s_p_L - s_rho_L*c_L*c_L)/(gamma-1.0)/rho_L;
-      D[1] = D[1] - c_L*pow(U[1]/c_L, 0.5/zeta)*(s_u_L + (gamma*s_p_L/c_L - c_L*s_rho_L)/(gamma-1.0)/rho_L);
+      D[1] = D[1] - c_L*pow_c*(s_u_L + (gamma*s_p_L/c_L - c_L*s_rho_L)/(gamma-1.0)/rho_L);
 
       D[2] = U[0]*U[1]*D[1];
 
-      D[0] = U[0]*U[1]*pow(U[1]/c_L, (1.0+zeta)/zeta)*(s_p_L - s_rho_L*c_L*c_L)/rho_L;
+      D[0] = U[0]*U[1]*pow_lin_fast(U[1]/c_L, (1.0+zeta)/zeta, pow_c, 2, 1)*(s_p_L - s_rho_L*c_L*c_L)/rho_L;
       D[0] = (D[0] + D[2]) / U[1]/U[1];
     }
     else if((CRW[1]) && ((u_star+c_star_R) < 0.0)) // the t-axe is in a 3-CRW
@@ -209,13 +212,14 @@ void linear_GRP_solver_Edir(double * D, double * U, const struct i_f_var *ifv_L,
       U[2] = pow(U[2], gamma/(gamma-1.0));
       U[0] = gamma*U[2]/U[1]/U[1];
 
-      D[1] = 0.5*(pow(-U[1]/c_R, 0.5/zeta)*(1.0+zeta) + pow(-U[1]/c_R, (1.0+zeta)/zeta)*zeta)/(0.5+zeta);
+      pow_c = pow(-U[1]/c_R, 0.5/zeta);
+      D[1] = 0.5*(pow_c*(1.0+zeta) + pow_lin_fast(-U[1]/c_R, (1.0+zeta)/zeta, pow_c, 2, 1)*zeta)/(0.5+zeta);
       D[1] = D[1] * (s_p_R - s_rho_R*c_R*c_R)/(gamma-1.0)/rho_R;
-      D[1] = D[1] + c_R*pow(-U[1]/c_R, 0.5/zeta)*(s_u_R - (gamma*s_p_R/c_R - c_R*s_rho_R)/(gamma-1.0)/rho_R);
+      D[1] = D[1] + c_R*pow_c*(s_u_R - (gamma*s_p_R/c_R - c_R*s_rho_R)/(gamma-1.0)/rho_R);
 
       D[2] = U[0]*U[1]*D[1];
 
-      D[0] = U[0]*U[1]*pow(-U[1]/c_R, (1.0+zeta)/zeta)*(s_p_R - s_rho_R*c_R*c_R)/rho_R;
+      D[0] = U[0]*U[1]*pow_lin_fast(-U[1]/c_R, (1.0+zeta)/zeta, pow_c, 2, 1)*(s_p_R - s_rho_R*c_R*c_R)/rho_R;
       D[0] = (D[0] + D[2]) / U[1]/U[1];
     }
     //--non-sonic case--
@@ -226,9 +230,10 @@ void linear_GRP_solver_Edir(double * D, double * U, const struct i_f_var *ifv_L,
       {
 	a_L = 1.0;
         b_L = 1.0 / rho_star_L / c_star_L;
-	d_L = 0.5*(pow(c_star_L/c_L, 0.5/zeta)*(1.0+zeta) + pow(c_star_L/c_L, (1.0+zeta)/zeta)*zeta)/(0.5+zeta);
+	pow_c = pow(c_star_L/c_L, 0.5/zeta);
+	d_L = 0.5*(pow_c*(1.0+zeta) + pow_lin_fast(c_star_L/c_L, (1.0+zeta)/zeta, pow_c, 2, 1)*zeta)/(0.5+zeta);
 	d_L = d_L * (s_p_L - s_rho_L*c_L*c_L)/(gamma-1.0)/rho_L;
-	d_L = d_L - c_L*pow(c_star_L/c_L, 0.5/zeta)*(s_u_L + (gamma*s_p_L/c_L - c_L*s_rho_L)/(gamma-1.0)/rho_L);
+	d_L = d_L - c_L*pow_c*(s_u_L + (gamma*s_p_L/c_L - c_L*s_rho_L)/(gamma-1.0)/rho_L);
       }
       else //the 1-wave is a shock
       {
@@ -251,9 +256,10 @@ void linear_GRP_solver_Edir(double * D, double * U, const struct i_f_var *ifv_L,
       {
 	a_R = 1.0;
         b_R = -1.0 / rho_star_R / c_star_R;
-	d_R = 0.5*(pow(c_star_R/c_R, 0.5/zeta)*(1.0+zeta) + pow(c_star_R/c_R, (1.0+zeta)/zeta)*zeta)/(0.5+zeta);
+	pow_c = pow(c_star_R/c_R, 0.5/zeta);
+	d_R = 0.5*(pow_c*(1.0+zeta) + pow_lin_fast(c_star_R/c_R, (1.0+zeta)/zeta, pow_c, 2, 1)*zeta)/(0.5+zeta);
 	d_R = d_R * (s_p_R - s_rho_R*c_R*c_R)/(gamma-1.0)/rho_R;
-	d_R = d_R + c_R*pow(c_star_R/c_R, 0.5/zeta)*(s_u_R - (gamma*s_p_R/c_R - c_R*s_rho_R)/(gamma-1.0)/rho_R);
+	d_R = d_R + c_R*pow_c*(s_u_R - (gamma*s_p_R/c_R - c_R*s_rho_R)/(gamma-1.0)/rho_R);
       }
       else //the 3-wave is a shock
       {
@@ -8,6 +8,14 @@
 
 #include "../include/var_struc.h"
 #include "../include/riemann_solver.h"
+#include "../include/tools.h"
+
+
+/**
+ * @brief Number of the Riemann problems whose Newton iteration does not converge, shared by all threads of any team.
+ */
+static long long GRP_unconverged = 0;
+
 
 /**
  * @brief A Quasi-1D direct Eulerian GRP solver for unsteady compressible inviscid two-component flow in two space dimension.
@@ -31,6 +39,8 @@
  *                - ifv_.t_ = -0.0: Planar-1D GRP solver
  *              - -0.0:     Quasi-1D GRP solver(only nonlinear case)
  *                - ifv_.t_ = -0.0: Planar-1D GRP solver
+ * @note  The star states are solved by Riemann_solver_adaptive() if config[52] >= 1.
+ *        The Riemann problems whose Newton iteration does not converge are counted for linear_GRP_solver_Edir_Q1D_unconverged().
  * @sa   Theory is found in Reference [1]. \n
  *       [1] M. Ben-Artzi, J. Li & G. Warnecke, A direct Eulerian GRP scheme for compressible fluid flows.
  *           Journal of Computational Physics, 218.1: 19-43, 2006.
@@ -38,6 +48,7 @@
 void linear_GRP_solver_Edir_Q1D
 (double *wave_speed, double *D, double *U, double *U_star, const struct i_f_var *ifv_L, const struct i_f_var *ifv_R, const double eps, const double atc)
 {
+	const double Q_AIRS = config[52]; // the pressure ratio bound of weak jumps for adaptive Riemann solver
 	const double lambda_u = ifv_L->lambda_u, lambda_v = ifv_L->lambda_v;
 	const double  gammaL = ifv_L->gamma,  gammaR = ifv_R->gamma;
 	const double   rho_L = ifv_L->RHO,     rho_R = ifv_R->RHO;
@@ -69,8 +80,9 @@ void linear_GRP_solver_Edir_Q1D
 #endif
 
 	_Bool CRW[2];
-	double dist;
+	double dist, gap;
 	double c_L, c_R, C, c_frac = 1.0;
+	double pow_p, pow_c; // (p_star/p_)^((γ-1)/(2γ)), (c_frac)^(0.5/zeta)
 
 	double d_Phi, d_Psi, TdS, VAR;
 	double D_rho, D_u, D_v, D_p, D_z, D_phi, T_rho, T_u, T_v, T_p, T_z, T_phi; 
@@ -106,11 +118,22 @@ void linear_GRP_solver_Edir_Q1D
 	    }
 	else //=========Riemann solver==========
 	    {
-		Riemann_solver_exact(&u_star, &p_star, gammaL, gammaR, u_L, u_R, p_L, p_R, c_L, c_R, CRW, eps, eps, 500);
+		if (Q_AIRS >= 1.0) // adaptive Riemann solver
+			gap = Riemann_solver_adaptive(&u_star, &p_star, gammaL, gammaR, rho_L, rho_R, u_L, u_R, p_L, p_R, c_L, c_R, CRW, eps, eps, 500, Q_AIRS);
+		else
+			gap = Riemann_solver_exact(&u_star, &p_star, gammaL, gammaR, u_L, u_R, p_L, p_R, c_L, c_R, CRW, eps, eps, 500);
+		if(!(gap <= eps))
+			{
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+				GRP_unconverged++;
+			}
 		if(CRW[0])
 		    {
-			rho_star_L = rho_L*pow(p_star/p_L, 1.0/gammaL);
-			c_star_L = c_L*pow(p_star/p_L, 0.5*(gammaL-1.0)/gammaL);
+			pow_p  = pow(p_star/p_L, 0.5*(gammaL-1.0)/gammaL);
+			rho_star_L = rho_L*pow_lin_fast(p_star/p_L, 1.0/gammaL, pow_p, -2, 1); // 1/γ = 1 - 2(γ-1)/(2γ)
+			c_star_L = c_L*pow_p;
 			speed_L = u_L - c_L;
 		    }
 		else
@@ -121,8 +144,9 @@ void linear_GRP_solver_Edir_Q1D
 		    }
 		if(CRW[1])
 		    {
-			rho_star_R = rho_R*pow(p_star/p_R,1.0/gammaR);
-			c_star_R = c_R*pow(p_star/p_R, 0.5*(gammaR-1.0)/gammaR);
+			pow_p  = pow(p_star/p_R, 0.5*(gammaR-1.0)/gammaR);
+			rho_star_R = rho_R*pow_lin_fast(p_star/p_R, 1.0/gammaR, pow_p, -2, 1); // 1/γ = 1 - 2(γ-1)/(2γ)
+			c_star_R = c_R*pow_p;
 			speed_R = u_R + c_R;
 		    }
 		else
@@ -298,14 +322,15 @@ void linear_GRP_solver_Edir_Q1D
 					U[5] = phi_L;
 
 					c_frac = C/c_L;
+					pow_c  = pow(c_frac, 0.5/zetaL);
 					TdS = (d_p_L - d_rho_L*c_L*c_L)/(gammaL-1.0)/rho_L;
 					d_Psi = d_u_L + (gammaL*d_p_L/c_L - c_L*d_rho_L)/(gammaL-1.0)/rho_L;
-					D[1] = ((1.0+zetaL)*pow(c_frac, 0.5/zetaL) + zetaL*pow(c_frac, (1.0+zetaL)/zetaL));
+					D[1] = ((1.0+zetaL)*pow_c + zetaL*pow_lin_fast(c_frac, (1.0+zetaL)/zetaL, pow_c, 2, 1));
 					D[1] = D[1]/(1.0+2.0*zetaL) * TdS;
-					D[1] = D[1] - c_L*pow(c_frac, 0.5/zetaL) * d_Psi;
+					D[1] = D[1] - c_L*pow_c * d_Psi;
 					D[3] = U[0]*(U[1] - lambda_u)*D[1];
 
-					D[0] = U[0]*(U[1] - lambda_u)*pow(c_frac, (1.0+zetaL)/zetaL)*TdS*(gammaL-1.0);
+					D[0] = U[0]*(U[1] - lambda_u)*pow_lin_fast(c_frac, (1.0+zetaL)/zetaL, pow_c, 2, 1)*TdS*(gammaL-1.0);
 					D[0] = (D[0] + D[3]) / C/C;
 
 					D[2] = -(U[1] - lambda_u)*d_v_L*U[0]/rho_L;
@@ -323,14 +348,15 @@ void linear_GRP_solver_Edir_Q1D
 					U[5] = phi_R;
 
 					c_frac = C/c_R;
+					pow_c  = pow(c_frac, 0.5/zetaR);
 					TdS = (d_p_R - d_rho_R*c_R*c_R)/(gammaR-1.0)/rho_R;
 					d_Phi = d_u_R - (gammaR*d_p_R/c_R - c_R*d_rho_R)/(gammaR-1.0)/rho_R;
-					D[1] = ((1.0+zetaR)*pow(c_frac, 0.5/zetaR) + zetaR*pow(c_frac, (1.0+zetaR)/zetaR));
+					D[1] = ((1.0+zetaR)*pow_c + zetaR*pow_lin_fast(c_frac, (1.0+zetaR)/zetaR, pow_c, 2, 1));
 					D[1] = D[1]/(1.0+2.0*zetaR) * TdS;
-					D[1] = D[1] + c_R*pow(c_frac, 0.5/zetaR)*d_Phi;
+					D[1] = D[1] + c_R*pow_c*d_Phi;
 					D[3] = U[0]*(U[1]-lambda_u)*D[1];
 
-					D[0] = U[0]*(U[1]-lambda_u)*pow(c_frac, (1.0+zetaR)/zetaR)*TdS*(gammaR-1.0);
+					D[0] = U[0]*(U[1]-lambda_u)*pow_lin_fast(c_frac, (1.0+zetaR)/zetaR, pow_c, 2, 1)*TdS*(gammaR-1.0);
 					D[0] = (D[0] + D[3]) / C/C;
 
 					D[2] = -(U[1]-lambda_u)*d_v_R*U[0]/rho_R;
@@ -366,11 +392,12 @@ void linear_GRP_solver_Edir_Q1D
 							a_L = 1.0;
 							b_L = 1.0 / rho_star_L / c_star_L;
 							c_frac = c_star_L/c_L;
+							pow_c  = pow(c_frac, 0.5/zetaL);
 							TdS = (d_p_L - d_rho_L*c_L*c_L)/(gammaL-1.0)/rho_L;
 							d_Psi = d_u_L + (gammaL*d_p_L/c_L - c_L*d_rho_L)/(gammaL-1.0)/rho_L;
-							d_L = ((1.0+zetaL)*pow(c_frac, 0.5/zetaL) + zetaL*pow(c_frac, (1.0+zetaL)/zetaL));
+							d_L = ((1.0+zetaL)*pow_c + zetaL*pow_lin_fast(c_frac, (1.0+zetaL)/zetaL, pow_c, 2, 1));
 							d_L = d_L/(1.0+2.0*zetaL) * TdS;
-							d_L = d_L - c_L*pow(c_frac, 0.5/zetaL) * d_Psi;
+							d_L = d_L - c_L*pow_c * d_Psi;
 						}
 					else //the 1-wave is a shock
 						{
@@ -397,11 +424,12 @@ void linear_GRP_solver_Edir_Q1D
 							a_R = 1.0;
 							b_R = -1.0 / rho_star_R / c_star_R;
 							c_frac = c_star_R/c_R;
+							pow_c  = pow(c_frac, 0.5/zetaR);
 							TdS = (d_p_R - d_rho_R*c_R*c_R)/(gammaR-1.0)/rho_R;
 							d_Phi = d_u_R - (gammaR*d_p_R/c_R - c_R*d_rho_R)/(gammaR-1.0)/rho_R;
-							d_R = ((1.0+zetaR)*pow(c_frac, 0.5/zetaR) + zetaR*pow(c_frac, (1.0+zetaR)/zetaR));
+							d_R = ((1.0+zetaR)*pow_c + zetaR*pow_lin_fast(c_frac, (1.0+zetaR)/zetaR, pow_c, 2, 1));
 							d_R = d_R/(1.0+2.0*zetaR) * TdS;
-							d_R = d_R + c_R*pow(c_frac, 0.5/zetaR) * d_Phi;
+							d_R = d_R + c_R*pow_c * d_Phi;
 						}
 					else //the 3-wave is a shock
 						{
@@ -552,3 +580,16 @@ void linear_GRP_solver_Edir_Q1D
 	U_star[4] = c_star_L;
 	U_star[5] = c_star_R;
 }
+
+
+/**
+ * @brief This function collects the number of Riemann problems whose Newton iteration does not converge
+ *        in linear_GRP_solver_Edir_Q1D(), and resets the counter, it is called outside of parallel regions.
+ * @return The number of the unconverged Riemann problems since the last call.
+ */
+long long linear_GRP_solver_Edir_Q1D_unconverged(void)
+{
+	long long const num = GRP_unconverged;
+	GRP_unconverged = 0;
+	return num;
+}
@@ -8,6 +8,7 @@
 
 #include "../include/var_struc.h"
 #include "../include/riemann_solver.h"
+#include "../include/tools.h"
 
 
 /**
@@ -54,6 +55,7 @@ void linear_GRP_solver_LAG(double * D, double * U, const struct i_f_var *ifv_L,
   double c_star_L, c_star_R, g_star_L, g_star_R;
   double u_star, p_star, rho_star_L, rho_star_R;
   double beta_star;
+  double pow_p;
 
   double a_L, b_L, d_L, a_R, b_R, d_R, L_rho, L_u, L_p, A, B;
 
@@ -61,8 +63,9 @@ void linear_GRP_solver_LAG(double * D, double * U, const struct i_f_var *ifv_L,
 
   if(CRW[0])
       {
-	  rho_star_L = rho_L*pow(p_star/p_L, 1.0/gammaL);
-	  c_star_L = c_L*pow(p_star/p_L, 0.5*(gammaL-1.0)/gammaL);
+	  pow_p = pow(p_star/p_L, 0.5*(gammaL-1.0)/gammaL);
+	  rho_star_L = rho_L*pow_lin_fast(p_star/p_L, 1.0/gammaL, pow_p, -2, 1);
+	  c_star_L = c_L*pow_p;
 	  // W_L = u_L - c_L;
       }
   else
@@ -73,8 +76,9 @@ void linear_GRP_solver_LAG(double * D, double * U, const struct i_f_var *ifv_L,
       }
   if(CRW[1])
       {
-	  rho_star_R = rho_R*pow(p_star/p_R,1.0/gammaR);
-	  c_star_R = c_R*pow(p_star/p_R, 0.5*(gammaR-1.0)/gammaR);
+	  pow_p = pow(p_star/p_R, 0.5*(gammaR-1.0)/gammaR);
+	  rho_star_R = rho_R*pow_lin_fast(p_star/p_R, 1.0/gammaR, pow_p, -2, 1);
+	  c_star_R = c_R*pow_p;
 	  // W_R = u_R + c_R;
       }
   else
@@ -0,0 +1,104 @@
+/**
+ * @file  riemann_solver_adaptive.c
+ * @brief This is an adaptive Riemann solver which chooses a cheap solver according to the jump strength.
+ * @sa   Theory is found in Section 9.5 of Reference [1]. \n
+ *       [1] E. F. Toro, "Riemann Solvers and Numerical Methods for Fluid Dynamics".
+ *           Springer-Verlag, Third Edition, 2009
+ */
+#include <stdio.h>
+#include <math.h>
+#include <stdbool.h>
+
+#include "../include/riemann_solver.h"
+
+
+/**
+ * @brief Numbers of the Riemann problems solved by PVRS, TRRS and the exact Riemann solver,
+ *        shared by all threads of any team.
+ */
+static long long AIRS_num[3] = {0, 0, 0};
+
+
+/**
+ * @brief ADAPTIVE RIEMANN SOLVER FOR Two-Component γ-Law Gas
+ * @details Weak jumps, i.e. p_max/p_min <= Q and the linearised pressure lies between p_L and p_R,
+ *          are solved by the Primitive Variable Riemann Solver (PVRS).
+ *          Two rarefaction waves of the same γ-law gas are solved exactly by the Two-Rarefaction Riemann Solver (TRRS).
+ *          The other jumps are solved by the exact Riemann solver Riemann_solver_exact().
+ * @param[out] U_star, P_star: Velocity/Pressure in star region.
+ * @param[in]  rho_L, u_L, p_L, c_L: Initial Density/Velocity/Pressure/sound_speed on left  state.
+ * @param[in]  rho_R, u_R, p_R, c_R: Initial Density/Velocity/Pressure/sound_speed on right state.
+ * @param[in]  gammaL, gammaR: Ratio of specific heats.
+ * @param[out] CRW: Centred Rarefaction Wave (CRW) Indicator of left and right waves.
+ *                  - true: CRW
+ *                  - false: Shock wave
+ * @param[in]  eps: The largest value can be seen as zero.
+ * @param[in]  tol: Condition value of 'gap' at the end of the iteration.
+ * @param[in]  N:   Maximum iteration step.
+ * @param[in]  Q:   Upper bound of the pressure ratio p_max/p_min of the weak jumps.
+ * @return  \b gap: Relative pressure change after the last iteration (0.0 for PVRS and TRRS).
+ */
+double Riemann_solver_adaptive(double * U_star, double * P_star, const double gammaL, const double gammaR,
+			       const double rho_L, const double rho_R, const double u_L, const double u_R,
+			       const double p_L, const double p_R, const double c_L, const double c_R, _Bool * CRW,
+			       const double eps, const double tol, const int N, const double Q)
+{
+  const double p_min = fmin(p_L, p_R), p_max = fmax(p_L, p_R);
+  double C, p_PV, z, p_TR;
+
+  //=====PVRS for weak jumps
+  C    = 0.25*(rho_L+rho_R)*(c_L+c_R);
+  p_PV = 0.5*(p_L+p_R) + 0.5*(u_L-u_R)*C;
+  if(p_max <= Q*p_min && p_min <= p_PV && p_PV <= p_max)
+  {
+    *P_star = p_PV;
+    *U_star = 0.5*(u_L+u_R) + 0.5*(p_L-p_R)/C;
+    CRW[0]  = p_PV <= p_L;
+    CRW[1]  = p_PV <= p_R;
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+    AIRS_num[0]++;
+    return 0.0;
+  }
+  //=====TRRS for two rarefaction waves
+  if(p_PV < p_min && gammaL == gammaR)
+  {
+    z    = (gammaL-1.0) / (2.0*gammaL);
+    p_TR = c_L + c_R - 0.5*(gammaL-1.0)*(u_R-u_L);
+    if(p_TR > 0.0)
+    {
+      p_TR = pow(p_TR / (c_L/pow(p_L, z) + c_R/pow(p_R, z)), 1.0/z);
+      if(p_TR <= p_min)
+      {
+        *P_star = p_TR;
+        *U_star = u_L - 2.0*c_L/(gammaL-1.0)*(pow(p_TR/p_L, z) - 1.0);
+        CRW[0]  = true;
+        CRW[1]  = true;
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+        AIRS_num[1]++;
+        return 0.0;
+      }
+    }
+  }
+  //=====exact Riemann solver for strong jumps
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+  AIRS_num[2]++;
+  return Riemann_solver_exact(U_star, P_star, gammaL, gammaR, u_L, u_R, p_L, p_R, c_L, c_R, CRW, eps, tol, N);
+}
+
+
+/**
+ * @brief This function collects the numbers of Riemann problems solved by each solver of Riemann_solver_adaptive(),
+ *        and resets the counters, it is called outside of parallel regions.
+ * @param[out] num: Numbers of Riemann problems solved by PVRS, TRRS and the exact Riemann solver.
+ */
+void Riemann_solver_adaptive_count(long long num[3])
+{
+  num[0] = AIRS_num[0]; num[1] = AIRS_num[1]; num[2] = AIRS_num[2];
+  AIRS_num[0] = 0; AIRS_num[1] = 0; AIRS_num[2] = 0;
+}
@@ -10,6 +10,8 @@
 #include <stdio.h>
 #include <stdbool.h>
 
+#include "../include/tools.h"
+
 
 /**
  * @brief EXACT RIEMANN SOLVER FOR Two-Component γ-Law Gas
@@ -37,6 +39,7 @@ double Riemann_solver_exact(double * U_star, double * P_star, const double gamma
   double delta_p, u_LR, u_RL;
   double k1, k3, p_INT, p_INT0, u_INT;
   double v_L, v_R, gap;
+  double pow_L = 1.0, pow_R = 1.0; // (p_INT/p_L)^muL, (p_INT/p_R)^muR at the last gap
   double temp1, temp2, temp3;
   int n = 0;
 
@@ -102,7 +105,8 @@ double Riemann_solver_exact(double * U_star, double * P_star, const double gamma
   }
   else
   {
-    v_L = pow(p_INT/p_L, muL) - 1.0;
+    pow_L = pow(p_INT/p_L, muL);
+    v_L = pow_L - 1.0;
     v_L = 2.0 * c_L * v_L / (gammaL-1.0);
     v_L = u_L - v_L;
   }
@@ -115,7 +119,8 @@ double Riemann_solver_exact(double * U_star, double * P_star, const double gamma
   }
   else
   {
-    v_R = pow(p_INT/p_R, muR) - 1.0;
+    pow_R = pow(p_INT/p_R, muR);
+    v_R = pow_R - 1.0;
     v_R = 2.0 * c_R * v_R / (gammaR-1.0);
     v_R = u_R + v_R;
   }
@@ -139,12 +144,12 @@ double Riemann_solver_exact(double * U_star, double * P_star, const double gamma
       temp1 = 1.0 / sqrt(1.0 + nuL*delta_p/p_L);
       temp2 = c_L / gammaL / p_L;
       temp3 = 0.5 * temp2 * nuL / p_L;
-      k1 = temp3*delta_p*pow(temp1,3.0) - temp2*temp1;
+      k1 = temp3*delta_p*pow_int_fast(temp1, 3) - temp2*temp1;
     }
     else
     {
       temp2 = c_L / gammaL / p_L;
-      temp1 = 1.0 / pow(p_INT/p_L, nuL);
+      temp1 = 1.0 / pow_lin_fast(p_INT/p_L, nuL, pow_L, -1, 1); // (γ+1)/(2γ) = 1 - (γ-1)/(2γ)
       k1 = -temp1 * temp2;
     }
     //the (p,u)-tangent slope on I3 at (v_R,p_INT), i.e. [du/dp](p_INT)
@@ -154,12 +159,12 @@ double Riemann_solver_exact(double * U_star, double * P_star, const double gamma
       temp1 = 1.0 / sqrt(1.0 + nuR*delta_p/p_R);
       temp2 = c_R / gammaR / p_R;
       temp3 = 0.5 * temp2 * nuR / p_R;
-      k3 = temp2*temp1 - temp3*delta_p*pow(temp1,3.0);
+      k3 = temp2*temp1 - temp3*delta_p*pow_int_fast(temp1, 3);
     }
     else
     {
       temp2 = c_R / gammaR / p_R;
-      temp1 = 1.0 / pow(p_INT/p_R, nuR);
+      temp1 = 1.0 / pow_lin_fast(p_INT/p_R, nuR, pow_R, -1, 1); // (γ+1)/(2γ) = 1 - (γ-1)/(2γ)
       k3 = temp1 * temp2;
     }
 
@@ -181,7 +186,8 @@ double Riemann_solver_exact(double * U_star, double * P_star, const double gamma
     }
     else
     {
-      v_L = pow(p_INT/p_L, muL) - 1.0;
+      pow_L = pow(p_INT/p_L, muL);
+      v_L = pow_L - 1.0;
       v_L = 2.0 * c_L * v_L / (gammaL-1.0);
       v_L = u_L - v_L;
     }
@@ -194,7 +200,8 @@ double Riemann_solver_exact(double * U_star, double * P_star, const double gamma
     }
     else
     {
-      v_R = pow(p_INT/p_R, muR) - 1.0;
+      pow_R = pow(p_INT/p_R, muR);
+      v_R = pow_R - 1.0;
       v_R = 2.0 * c_R * v_R / (gammaR-1.0);
       v_R = u_R + v_R;
     }
@@ -236,6 +243,7 @@ double Riemann_solver_exact_Ben(double * U_star, double * P_star, const double g
   double delta_p, u_LR, u_RL;
   double k1, k3, p_INT, p_INT0, u_INT;
   double v_L, v_R, gap;
+  double pow_L = 1.0, pow_R = 1.0; // (p_INT/p_L)^mu, (p_INT/p_R)^mu at the last gap
   double temp1, temp2, temp3;
   int n = 0;
 
@@ -299,7 +307,8 @@ double Riemann_solver_exact_Ben(double * U_star, double * P_star, const double g
   }
   else
   {
-    v_L = pow(p_INT/p_L, mu) - 1.0;
+    pow_L = pow(p_INT/p_L, mu);
+    v_L = pow_L - 1.0;
     v_L = 2.0 * c_L * v_L / (gamma-1.0);
     v_L = u_L - v_L;
   }
@@ -312,7 +321,8 @@ double Riemann_solver_exact_Ben(double * U_star, double * P_star, const double g
   }
   else
   {
-    v_R = pow(p_INT/p_R, mu) - 1.0;
+    pow_R = pow(p_INT/p_R, mu);
+    v_R = pow_R - 1.0;
     v_R = 2.0 * c_R * v_R / (gamma-1.0);
     v_R = u_R + v_R;
   }
@@ -336,12 +346,12 @@ double Riemann_solver_exact_Ben(double * U_star, double * P_star, const double g
       temp1 = 1.0 / sqrt(1.0 + nu*delta_p/p_L);
       temp2 = c_L / gamma / p_L;
       temp3 = 0.5 * temp2 * nu / p_L;
-      k1 = temp3*delta_p*pow(temp1,3.0) - temp2*temp1;
+      k1 = temp3*delta_p*pow_int_fast(temp1, 3) - temp2*temp1;
     }
     else
     {
       temp2 = c_L / gamma / p_L;
-      temp1 = 1.0 / pow(p_INT/p_L, nu);
+      temp1 = 1.0 / pow_lin_fast(p_INT/p_L, nu, pow_L, -1, 1); // (γ+1)/(2γ) = 1 - (γ-1)/(2γ)
       k1 = -temp1 * temp2;
     }
     //the (p,u)-tangent slope on I3 at (v_R,p_INT), i.e. [du/dp](p_INT)
@@ -351,12 +361,12 @@ double Riemann_solver_exact_Ben(double * U_star, double * P_star, const double g
       temp1 = 1.0 / sqrt(1.0 + nu*delta_p/p_R);
       temp2 = c_R / gamma / p_R;
       temp3 = 0.5 * temp2 * nu / p_R;
-      k3 = temp2*temp1 - temp3*delta_p*pow(temp1,3.0);
+      k3 = temp2*temp1 - temp3*delta_p*pow_int_fast(temp1, 3);
     }
     else
     {
       temp2 = c_R / gamma / p_R;
-      temp1 = 1.0 / pow(p_INT/p_R, nu);
+      temp1 = 1.0 / pow_lin_fast(p_INT/p_R, nu, pow_R, -1, 1); // (γ+1)/(2γ) = 1 - (γ-1)/(2γ)
       k3 = temp1 * temp2;
     }
 
@@ -378,7 +388,8 @@ double Riemann_solver_exact_Ben(double * U_star, double * P_star, const double g
     }
     else
     {
-      v_L = pow(p_INT/p_L, mu) - 1.0;
+      pow_L = pow(p_INT/p_L, mu);
+      v_L = pow_L - 1.0;
       v_L = 2.0 * c_L * v_L / (gamma-1.0);
       v_L = u_L - v_L;
     }
@@ -391,7 +402,8 @@ double Riemann_solver_exact_Ben(double * U_star, double * P_star, const double g
     }
     else
     {
-      v_R = pow(p_INT/p_R, mu) - 1.0;
+      pow_R = pow(p_INT/p_R, mu);
+      v_R = pow_R - 1.0;
       v_R = 2.0 * c_R * v_R / (gamma-1.0);
       v_R = u_R + v_R;
     }
@@ -7,6 +7,8 @@
 #include <stdio.h>
 #include <stdbool.h>
 
+#include "../include/tools.h"
+
 
 /**
  * @brief EXACT RIEMANN SOLVER FOR THE EULER EQUATIONS
@@ -44,6 +46,7 @@ double Riemann_solver_exact_Toro(double * U_star, double * P_star, const double
     double P_int,U_int; // =>P_star,U_star
     double P_int_save;
     double f_R = 0.0,f_L = 0.0,df_R,df_L;
+    double pow_L, pow_R, sqrt_L, sqrt_R;
 
     double RHO_r=gamma * P_r/c_r/c_r;
     double RHO_l=gamma * P_l/c_l/c_l;
@@ -72,23 +75,27 @@ double Riemann_solver_exact_Toro(double * U_star, double * P_star, const double
 
 	    if(P_int > P_l)
 		{
-		    f_L=(P_int - P_l)*pow(A_L/(P_int+B_L),0.5);
-		    df_L=pow(A_L/(P_int+B_L),0.5)-0.5*(P_int - P_l)*pow(A_L,0.5)/pow(P_int+B_L,1.5);
+		    sqrt_L=sqrt(A_L/(P_int+B_L));
+		    f_L=(P_int - P_l)*sqrt_L;
+		    df_L=sqrt_L-0.5*(P_int - P_l)*sqrt_L/(P_int+B_L);
 		}
 	    else
 		{
-		    f_L=2.0*c_l/g8*(pow(P_int/P_l,1.0/g3)-1.0);
-		    df_L=c_l/gamma/P_l*pow(P_int/P_l,1.0/g3-1.0);
+		    pow_L=pow(P_int/P_l,1.0/g3);
+		    f_L=2.0*c_l/g8*(pow_L-1.0);
+		    df_L=c_l/gamma/P_l*pow_lin_fast(P_int/P_l,1.0/g3-1.0,pow_L,1,-1);
 		}
 	    if(P_int > P_r)
 		{
-		    f_R=(P_int - P_r)*pow(A_R/(P_int+B_R),0.5);
-		    df_R=pow(A_R/(P_int+B_R),0.5)-0.5*(P_int - P_r)*pow(A_R,0.5)/pow(P_int+B_R,1.5);
+		    sqrt_R=sqrt(A_R/(P_int+B_R));
+		    f_R=(P_int - P_r)*sqrt_R;
+		    df_R=sqrt_R-0.5*(P_int - P_r)*sqrt_R/(P_int+B_R);
 		}
 	    else
 		{
-		    f_R=2.0*c_r/g8*(pow(P_int/P_r,1.0/g3)-1.0);
-		    df_R=c_r/gamma/P_r*pow(P_int/P_r,1.0/g3-1.0);
+		    pow_R=pow(P_int/P_r,1.0/g3);
+		    f_R=2.0*c_r/g8*(pow_R-1.0);
+		    df_R=c_r/gamma/P_r*pow_lin_fast(P_int/P_r,1.0/g3-1.0,pow_R,1,-1);
 		}
 
 	    P_int=P_int - (f_L - f_R + U_r - U_l)/(df_L-df_R);
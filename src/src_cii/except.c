@@ -24,6 +24,8 @@ void Except_raise(const T *e, const char *file,
 			fprintf(stderr, " at 0x%p", (void *)e);
 		if (file && line > 0)
 			fprintf(stderr, " raised at %s:%d\n", file, line);
+		else if (file)
+			fprintf(stderr, " raised in %s\n", file);
 		fprintf(stderr, "aborting...\n");
 		fflush(stderr);
 		abort();
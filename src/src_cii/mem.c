@@ -1,18 +1,138 @@
 /**
  * @file mem.c
  * @brief This file is the source codes in the book 'C Interfaces and Implementations'.
+ * @details If MEM_STAT is defined, each block carries a header with its size and tag,
+ *          and the live bytes, the high-water mark and the number of allocations are accounted per tag.
+ *          The tag is the name given to ALLOC_TAG()/CALLOC_TAG(), or the source file of ALLOC()/CALLOC().
+ *          The statistics are printed by Mem_stat_print() on demand and at exit.
  */
 
 #include <stdlib.h>
 #include <stddef.h>
 #include <assert.h>
+#include <stdio.h>
+#include <string.h>
 #include "../include_cii/except.h"
 #include "../include_cii/mem.h"
 const Except_T Mem_Failed = { (char*)"Allocation Failed" };
+
+#ifdef MEM_STAT
+//! Maximum number of tags in the memory statistics, the last one collects the others.
+#define MEM_STAT_N 64
+
+//! Header in front of each block, aligned for any data type.
+union Mem_head {
+	struct {
+		long nbytes; //!< Size of the block requested by the caller.
+		int  tag;    //!< Serial number of the tag in 'Mem_tags'.
+	} s;
+	long double ld;
+	void * p;
+};
+
+//! Statistics of each tag.
+static struct {
+	const char * name;
+	long live, peak, count;
+} Mem_tags[MEM_STAT_N];
+static int  Mem_ntag = 0;
+static long Mem_live = 0, Mem_peak = 0;
+
+static void Mem_stat_exit(void)
+{
+	printf("Memory in use at exit:\n");
+	Mem_stat_print();
+}
+
+/**
+ * @brief This function finds or registers the tag of an allocation.
+ * @param[in] file: Tag name if line is 0, otherwise the source file of the allocation.
+ * @param[in] line: Source line of the allocation.
+ * @return Serial number of the tag in 'Mem_tags'.
+ */
+static int Mem_tag_find(const char * file, int line)
+{
+	const char * name = file ? file : "unknown";
+	const char * s;
+	int i;
+	if (line > 0)
+		for (s = name; *s; s++)
+			if (*s == '/' || *s == '\\')
+				name = s + 1;
+	for (i = 0; i < Mem_ntag; i++)
+		if (strcmp(Mem_tags[i].name, name) == 0)
+			return i;
+	if (Mem_ntag == MEM_STAT_N)
+		return MEM_STAT_N-1;
+	if (Mem_ntag == 0)
+		atexit(Mem_stat_exit);
+	if (Mem_ntag == MEM_STAT_N-1)
+		name = "others";
+	Mem_tags[Mem_ntag].name = name;
+	return Mem_ntag++;
+}
+
+/**
+ * @brief This function accounts nbytes (negative for releasing) and count new allocations under the tag.
+ */
+static void Mem_stat_add(int tag, long nbytes, int count)
+{
+#pragma omp critical (Mem_stat)
+	{
+		Mem_tags[tag].live += nbytes;
+		if (Mem_tags[tag].live > Mem_tags[tag].peak)
+			Mem_tags[tag].peak = Mem_tags[tag].live;
+		Mem_tags[tag].count += count;
+		Mem_live += nbytes;
+		if (Mem_live > Mem_peak)
+			Mem_peak = Mem_live;
+	}
+}
+
+/**
+ * @brief This function writes the header of a new block and accounts it.
+ * @return The user part of the block.
+ */
+static void *Mem_stat_new(union Mem_head *h, long nbytes, const char *file, int line)
+{
+	int tag;
+#pragma omp critical (Mem_stat)
+	tag = Mem_tag_find(file, line);
+	h->s.nbytes = nbytes;
+	h->s.tag    = tag;
+	Mem_stat_add(tag, nbytes, 1);
+	return h + 1;
+}
+#endif
+
+/**
+ * @brief This function prints the live bytes, the high-water mark and the number of allocations of each tag.
+ * @details It does nothing unless MEM_STAT is defined.
+ */
+void Mem_stat_print(void)
+{
+#ifdef MEM_STAT
+	const double MiB = 1024.0*1024.0;
+	int i;
+#pragma omp critical (Mem_stat)
+	{
+		printf("%-34s %12s  %12s  %12s\n", "Memory statistics (MiB):", "live", "peak", "allocations");
+		for (i = 0; i < Mem_ntag; i++)
+			printf("  %-32.32s %12.3f  %12.3f  %12ld\n", Mem_tags[i].name,
+			       Mem_tags[i].live/MiB, Mem_tags[i].peak/MiB, Mem_tags[i].count);
+		printf("  %-32s %12.3f  %12.3f\n", "total", Mem_live/MiB, Mem_peak/MiB);
+		fflush(stdout);
+	}
+#endif
+}
 void *Mem_alloc(long nbytes, const char *file, int line){
 	void *ptr;
 	assert(nbytes > 0);
+#ifdef MEM_STAT
+	ptr = malloc(sizeof(union Mem_head) + nbytes);
+#else
 	ptr = malloc(nbytes);
+#endif
 	if (ptr == NULL)
 		{
 			if (file == NULL)
@@ -20,6 +140,9 @@ void *Mem_alloc(long nbytes, const char *file, int line){
 			else
 				Except_raise(&Mem_Failed, file, line);
 		}
+#ifdef MEM_STAT
+	ptr = Mem_stat_new((union Mem_head *)ptr, nbytes, file, line);
+#endif
 	return ptr;
 }
 void *Mem_calloc(long count, long nbytes,
@@ -27,7 +150,11 @@ void *Mem_calloc(long count, long nbytes,
 	void *ptr;
 	assert(count > 0);
 	assert(nbytes > 0);
+#ifdef MEM_STAT
+	ptr = calloc(1, sizeof(union Mem_head) + count*nbytes);
+#else
 	ptr = calloc(count, nbytes);
+#endif
 	if (ptr == NULL)
 		{
 			if (file == NULL)
@@ -35,17 +162,34 @@ void *Mem_calloc(long count, long nbytes,
 			else
 				Except_raise(&Mem_Failed, file, line);
 		}
+#ifdef MEM_STAT
+	ptr = Mem_stat_new((union Mem_head *)ptr, count*nbytes, file, line);
+#endif
 	return ptr;
 }
 void Mem_free(void *ptr, const char *file, int line) {
 	if (ptr)
-		free(ptr);
+		{
+#ifdef MEM_STAT
+			union Mem_head *h = (union Mem_head *)ptr - 1;
+			Mem_stat_add(h->s.tag, -h->s.nbytes, 0);
+			ptr = h;
+#endif
+			free(ptr);
+		}
 }
 void *Mem_resize(void *ptr, long nbytes,
 	const char *file, int line) {
 	assert(ptr);
 	assert(nbytes > 0);
+#ifdef MEM_STAT
+	union Mem_head *h = (union Mem_head *)ptr - 1;
+	int tag = h->s.tag;
+	long old = h->s.nbytes;
+	ptr = realloc(h, sizeof(union Mem_head) + nbytes);
+#else
 	ptr = realloc(ptr, nbytes);
+#endif
 	if (ptr == NULL)
 		{
 			if (file == NULL)
@@ -53,5 +197,11 @@ void *Mem_resize(void *ptr, long nbytes,
 			else
 				Except_raise(&Mem_Failed, file, line);
 		}
+#ifdef MEM_STAT
+	h = (union Mem_head *)ptr;
+	h->s.nbytes = nbytes;
+	Mem_stat_add(tag, nbytes - old, 0);
+	ptr = h + 1;
+#endif
 	return ptr;
 }
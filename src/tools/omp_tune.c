@@ -0,0 +1,233 @@
+/**
+ * @file  omp_tune.c
+ * @brief There are functions which tune the number of OpenMP threads, the loop schedule and the tile edge of each kernel.
+ * @details A tuned kernel runs its worksharing loop with schedule(runtime) and num_threads() set by omp_tune_begin().
+ *          If config[56] is 0, the kernels keep their default configuration.
+ *          Otherwise each kernel times TUNE_REPS calls of each candidate configuration during the first time steps,
+ *          after one warm-up call, and locks in the fastest one.
+ *          The tuned configurations are appended to the file TUNE_FILE by omp_tune_save(), and read by later runs
+ *          on the same machine (host name, number of processors and threads) with the same grid size if config[56] is 1.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#ifdef _WIN32
+#include <stdlib.h>
+#elif __linux__
+#include <sys/utsname.h>
+#endif
+
+#include "../include/var_struc.h"
+#include "../include/tools.h"
+
+//! Number of timed calls of each candidate.
+#define TUNE_REPS 2
+//! Maximum number of candidates of a kernel.
+#define TUNE_CAND 16
+//! Name of the file of the tuned configurations.
+#define TUNE_FILE "omp_tune.txt"
+
+//! Configuration of a kernel.
+struct tune_conf {
+	int sched;    //!< omp_sched_t of the loop schedule.
+	int chunk;    //!< Chunk size of the loop schedule, or tile edge for TUNE_TILE.
+	int n_thread; //!< Number of threads.
+};
+
+//! Tuning state of each kernel.
+static struct {
+	int cand;   //!< Candidate being timed, -1 if the configuration is locked.
+	int n_cand, calls;
+	int tuned;  //!< Whether the configuration is tuned by this run.
+	double t0, time[TUNE_CAND];
+	struct tune_conf conf[TUNE_CAND], best;
+} Tune[TUNE_N];
+static const char * Tune_name[TUNE_N] = {"limiter_x", "limiter_y", "flux_x", "flux_y", "update", "update_x", "update_y", "tile"};
+static const char * Tune_sched[5] = {"-", "static", "dynamic", "guided", "auto"};
+static int  Tune_m, Tune_n, Tune_procs, Tune_threads;
+static char Tune_host[65] = "unknown";
+
+#ifdef _OPENMP
+/**
+ * @brief This function reads the tuned configurations of this machine and grid size from TUNE_FILE,
+ *        the last matching line of a kernel wins.
+ */
+static void omp_tune_load(void)
+{
+	FILE * fp;
+	char host[65], kernel[17];
+	int m, n, procs, threads, k;
+	struct tune_conf c;
+	if ((fp = fopen(TUNE_FILE, "r")) == NULL)
+		return;
+	while (fscanf(fp, "%64s %d %d %d %d %16s %d %d %d", host, &m, &n, &procs, &threads,
+		      kernel, &c.sched, &c.chunk, &c.n_thread) == 9)
+		{
+			if (strcmp(host, Tune_host) || m != Tune_m || n != Tune_n || procs != Tune_procs || threads != Tune_threads)
+				continue;
+			for (k = 0; k < TUNE_N; k++)
+				if (strcmp(kernel, Tune_name[k]) == 0 && Tune[k].cand >= 0)
+					{
+						Tune[k].best = c;
+						Tune[k].cand = -2; // locked by the file, it may be replaced by a later line
+					}
+		}
+	fclose(fp);
+	for (k = 0; k < TUNE_N; k++)
+		if (Tune[k].cand == -2)
+			{
+				Tune[k].cand = -1;
+				printf("@@ OpenMP tuning of %s read from %s.\n", Tune_name[k], TUNE_FILE);
+			}
+}
+#endif
+
+/**
+ * @brief This function sets the default configurations of the kernels and the candidates to be tuned.
+ * @param[in] m: Number of the x-grids: n_x.
+ * @param[in] n: Number of the y-grids: n_y.
+ */
+void omp_tune_init(const int m, const int n)
+{
+	int const mode = (int)config[56]; // 0: default, 1: tune or read the file, 2: tune
+	int const tile[4] = {8, 16, 32, 64};
+	int k, s, t, n_t = 1;
+	Tune_m = m;
+	Tune_n = n;
+	Tune_threads = 1;
+	Tune_procs   = 1;
+#ifdef _OPENMP
+	Tune_threads = omp_get_max_threads();
+	Tune_procs   = omp_get_num_procs();
+#endif
+	for (k = 0; k < TUNE_N; k++)
+		{
+			Tune[k].cand   = -1;
+			Tune[k].n_cand = 0;
+			Tune[k].calls  = -1;
+			Tune[k].tuned  = 0;
+			Tune[k].best   = (struct tune_conf){2, 8, Tune_threads}; // schedule(dynamic, 8)
+		}
+	Tune[TUNE_UPDATE].best = Tune[TUNE_UPDATE_X].best = Tune[TUNE_UPDATE_Y].best = (struct tune_conf){1, 0, Tune_threads};
+	Tune[TUNE_TILE].best = (struct tune_conf){0, (int)config[55], Tune_threads};
+#ifdef _OPENMP
+	if (mode == 0)
+		return;
+	for (k = 0; k < TUNE_N; k++)
+		{
+			if (k == TUNE_TILE)
+				{
+					if ((int)config[55] <= 0)
+						continue;
+					for (s = 0; s < 4; s++)
+						if (tile[s] < (m > n ? m : n))
+							Tune[k].conf[Tune[k].n_cand++] = (struct tune_conf){0, tile[s], Tune_threads};
+				}
+			else
+				for (t = Tune_threads; t > 0 && n_t <= 2; t /= 2, n_t++) // all and half of the threads
+					{
+						Tune[k].conf[Tune[k].n_cand++] = (struct tune_conf){1, 0,  t}; // static
+						Tune[k].conf[Tune[k].n_cand++] = (struct tune_conf){2, 8,  t}; // dynamic, 8
+						Tune[k].conf[Tune[k].n_cand++] = (struct tune_conf){2, 32, t}; // dynamic, 32
+						Tune[k].conf[Tune[k].n_cand++] = (struct tune_conf){3, 8,  t}; // guided, 8
+					}
+			n_t = 1;
+			if (Tune[k].n_cand > 1)
+				Tune[k].cand = 0;
+		}
+#ifdef _WIN32
+	if (getenv("COMPUTERNAME"))
+		snprintf(Tune_host, sizeof(Tune_host), "%s", getenv("COMPUTERNAME"));
+#elif __linux__
+	struct utsname u;
+	if (uname(&u) == 0)
+		snprintf(Tune_host, sizeof(Tune_host), "%s", u.nodename);
+#endif
+	printf("@@ OpenMP auto-tuning in the first time steps.\n");
+	if (mode == 1)
+		omp_tune_load();
+#else
+	(void)mode; (void)tile; (void)s; (void)t; (void)n_t;
+#endif
+}
+
+/**
+ * @brief This function sets the loop schedule of a kernel and starts timing it, it is called outside of parallel regions.
+ * @param[in] kernel: Kernel in 'enum omp_tune_kernel'.
+ * @return The number of threads of the kernel, or the tile edge for TUNE_TILE.
+ */
+int omp_tune_begin(const int kernel)
+{
+	const struct tune_conf * c = Tune[kernel].cand < 0 ? &Tune[kernel].best : Tune[kernel].conf + Tune[kernel].cand;
+#ifdef _OPENMP
+	if (kernel != TUNE_TILE)
+		omp_set_schedule((omp_sched_t)c->sched, c->chunk);
+#endif
+	Tune[kernel].t0 = wall_time();
+	return kernel == TUNE_TILE ? c->chunk : c->n_thread;
+}
+
+/**
+ * @brief This function ends timing a kernel, and locks in the fastest candidate after all candidates are timed.
+ * @param[in] kernel: Kernel in 'enum omp_tune_kernel'.
+ */
+void omp_tune_end(const int kernel)
+{
+	int c, best = 0;
+	if (Tune[kernel].cand < 0)
+		return;
+	if (Tune[kernel].calls < 0) // warm-up call
+		{
+			Tune[kernel].calls = 0;
+			return;
+		}
+	if (Tune[kernel].calls == 0)
+		Tune[kernel].time[Tune[kernel].cand] = 0.0;
+	Tune[kernel].time[Tune[kernel].cand] += wall_time() - Tune[kernel].t0;
+	if (++Tune[kernel].calls < TUNE_REPS)
+		return;
+	Tune[kernel].calls = 0;
+	if (++Tune[kernel].cand < Tune[kernel].n_cand)
+		return;
+
+	for (c = 1; c < Tune[kernel].n_cand; c++)
+		if (Tune[kernel].time[c] < Tune[kernel].time[best])
+			best = c;
+	Tune[kernel].best = Tune[kernel].conf[best];
+	Tune[kernel].cand  = -1;
+	Tune[kernel].tuned = 1;
+	if (kernel == TUNE_TILE)
+		printf("\n@@ OpenMP tuning of %s: edge %d.\n", Tune_name[kernel], Tune[kernel].best.chunk);
+	else
+		printf("\n@@ OpenMP tuning of %s: schedule(%s, %d), %d threads.\n", Tune_name[kernel],
+		       Tune_sched[Tune[kernel].best.sched > 0 && Tune[kernel].best.sched < 5 ? Tune[kernel].best.sched : 0], Tune[kernel].best.chunk, Tune[kernel].best.n_thread);
+}
+
+/**
+ * @brief This function appends the configurations tuned by this run to TUNE_FILE.
+ */
+void omp_tune_save(void)
+{
+	FILE * fp;
+	int k, n_new = 0;
+	for (k = 0; k < TUNE_N; k++)
+		n_new += Tune[k].tuned;
+	if (n_new == 0)
+		return;
+	if ((fp = fopen(TUNE_FILE, "a")) == NULL)
+		{
+			printf("Warning: Can't write the OpenMP tuning file(%s)!\n", TUNE_FILE);
+			return;
+		}
+	for (k = 0; k < TUNE_N; k++)
+		if (Tune[k].tuned)
+			fprintf(fp, "%s %d %d %d %d %s %d %d %d\n", Tune_host, Tune_m, Tune_n, Tune_procs, Tune_threads,
+				Tune_name[k], Tune[k].best.sched, Tune[k].best.chunk, Tune[k].best.n_thread);
+	if (fclose(fp) != 0)
+		printf("Warning: Fail to write the OpenMP tuning file(%s)!\n", TUNE_FILE);
+	for (k = 0; k < TUNE_N; k++)
+		Tune[k].tuned = 0;
+}
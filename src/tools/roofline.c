@@ -0,0 +1,124 @@
+/**
+ * @file  roofline.c
+ * @brief There are functions which count the memory traffic and the floating-point operations of the solver phases.
+ * @details If ROOFLINE is defined, RL_END() accounts the wall time of a phase together with the bytes moved and
+ *          the flops derived analytically from the data structures touched by its kernel, i.e. the counts per grid cell
+ *          and per cell interface in the table 'RL_count' times the numbers of cells and interfaces.
+ *          The bytes are the compulsory traffic, each array element touched by a sweep is moved once,
+ *          the gathered neighbours and the small structures living in cache are not counted.
+ *          The achieved GB/s, GFLOP/s and arithmetic intensity of each phase are printed at exit,
+ *          to tell the bandwidth-bound phases from the compute-bound ones on the roofline of the machine.
+ *          Otherwise the macro only ends the timeline event, and nothing is compiled here.
+ */
+
+#include "../include/tools.h"
+
+#ifdef ROOFLINE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//! Flops of linear_GRP_solver_Edir_Q1D() with GRP_2D_flux(), 3 iterations of the exact Riemann solver, pow()/sqrt() count as one flop.
+#define FLOP_GRP 450.0
+
+#ifdef MULTIFLUID_BASICS
+#define NV 6 //!< Number of primitive variables reconstructed on unstructured grids.
+#define NF 11 //!< Number of fluxes per interface read by the update on unstructured grids.
+#define NW 18 //!< Number of interfacial values written by the fluxes on unstructured grids.
+#else
+#define NV 4
+#define NF 4
+#define NW 8
+#endif
+
+//! Bytes and flops per grid cell and per cell interface of each kernel in 'enum roofline_kernel'.
+static const struct {
+	double bytes_cell, flops_cell, bytes_edge, flops_edge;
+} RL_count[RL_N] = {
+	// CFL: read RHO, U, V, P; sound speed, character speed and minimum.
+	[RL_CFL_2D]        = {4*8,  7,  0, 0},
+	// minmod limiter of 4 variables: read U, read/write s; 2 differences, 2 divisions, 2 products of alpha and 2 sign tests.
+	[RL_LIMITER_2D]    = {4*24, 32, 0, 0},
+	// GRP flux: read RHO, U, V, P, s_*, t_* of a cell; write F_* and *I of the interface; 8 reconstructions.
+	[RL_FLUX_2D]       = {0, 0, 12*8+8*8, 24+FLOP_GRP},
+	// GRP flux without transversal terms: t_* are not read.
+	[RL_FLUX_2D_SPLIT] = {0, 0, 8*8+8*8,  24+FLOP_GRP},
+	// update: read RHO, U, V, E, F_*, G_*, *Ix, *Iy; write RHO, U, V, E, P, s_*, t_*; conservative update, health sums, slopes.
+	[RL_UPDATE_2D]     = {20*8+13*8, 70, 0, 0},
+	// x-sweep update: read RHO, U, V, E, F_*, *Ix; write RHO, U, V, E, P, s_*.
+	[RL_UPDATE_2D_X]   = {12*8+9*8, 31, 0, 0},
+	// y-sweep update: as the x-sweep, plus the health sums.
+	[RL_UPDATE_2D_Y]   = {12*8+9*8, 44, 0, 0},
+	// task graph of a whole step: two limiters and the update per cell, the fluxes per interface.
+	[RL_TASK_2D]       = {2*4*24+20*8+13*8, 2*32+70, 12*8+8*8, 24+FLOP_GRP},
+	[RL_TASK_2D_X]     = {4*24+12*8+9*8, 32+31, 8*8+8*8, 24+FLOP_GRP},
+	[RL_TASK_2D_Y]     = {4*24+12*8+9*8, 32+44, 8*8+8*8, 24+FLOP_GRP},
+	// CFL on unstructured grids: read vol and the cell state; read cell_cell, normals and length of an edge, wave speeds.
+	[RL_CFL_UNSTRUCT]     = {(NV+1)*8, 2, 4+3*8, 8*NV+15},
+	// lsq_limiter() of NV variables: read W, X_c, Y_c, write the gradients of a cell; read cell_cell and cell_pt of an edge;
+	// 2x2 least squares and inversion per cell, the moments and the limiter function per edge.
+	[RL_LIMITER_UNSTRUCT] = {NV*40, NV*20, NV*8, NV*35},
+	// interfacial fluxes: read the state and the gradients of a cell; read cell_cell and normals, write NW values of an edge.
+	[RL_FLUX_UNSTRUCT]    = {(3*NV+2)*8, 0, 4+2*8+NW*8, 8*NV+FLOP_GRP},
+	// conservative update: read/write the conservative variables of a cell; read cell_pt and NF fluxes of an edge, edge length.
+	[RL_UPDATE_UNSTRUCT]  = {2*(NV+1)*8, (NV-4)*6, 4+NF*8, 6+16+(NF-4)*3}
+};
+
+//! Maximum number of phases, the phases beyond it are dropped.
+#define RL_PHASES 32
+
+//! Counters of each phase.
+static struct {
+	const char * name;
+	long   calls;
+	double time, bytes, flops;
+} RL_phase[RL_PHASES];
+static int RL_nphase = 0;
+
+/**
+ * @brief This function prints the counters of all phases, registered by atexit().
+ */
+static void roofline_print(void)
+{
+	int p;
+	printf("%-24s %8s %10s %10s %10s %9s %9s %8s\n", "Roofline counters:",
+	       "calls", "time(s)", "GB", "GFLOP", "GB/s", "GFLOP/s", "flop/B");
+	for (p = 0; p < RL_nphase; p++)
+		printf("  %-22.22s %8ld %10.4f %10.4f %10.4f %9.3f %9.3f %8.3f\n", RL_phase[p].name, RL_phase[p].calls,
+		       RL_phase[p].time, RL_phase[p].bytes*1e-9, RL_phase[p].flops*1e-9,
+		       RL_phase[p].time > 0.0 ? RL_phase[p].bytes*1e-9/RL_phase[p].time : 0.0,
+		       RL_phase[p].time > 0.0 ? RL_phase[p].flops*1e-9/RL_phase[p].time : 0.0,
+		       RL_phase[p].bytes > 0.0 ? RL_phase[p].flops/RL_phase[p].bytes : 0.0);
+	fflush(stdout);
+}
+
+/**
+ * @brief This function accounts a call of a phase, it is called outside of parallel regions.
+ * @param[in] name:   Name of the phase, it must be a string literal.
+ * @param[in] t0:     Start time of the phase from wall_time().
+ * @param[in] kernel: Kernel of the phase in 'enum roofline_kernel'.
+ * @param[in] n_cell: Number of grid cells swept.
+ * @param[in] n_edge: Number of cell interfaces swept.
+ */
+void roofline_add(const char * name, const double t0, const int kernel, const double n_cell, const double n_edge)
+{
+	const double t1 = wall_time();
+	int p;
+	TL_END(name, t0);
+	for (p = 0; p < RL_nphase; p++)
+		if (RL_phase[p].name == name || strcmp(RL_phase[p].name, name) == 0)
+			break;
+	if (p == RL_nphase)
+		{
+			if (RL_nphase == RL_PHASES)
+				return;
+			if (RL_nphase == 0)
+				atexit(roofline_print);
+			RL_phase[RL_nphase++].name = name;
+		}
+	RL_phase[p].calls++;
+	RL_phase[p].time  += t1 - t0;
+	RL_phase[p].bytes += n_cell*RL_count[kernel].bytes_cell + n_edge*RL_count[kernel].bytes_edge;
+	RL_phase[p].flops += n_cell*RL_count[kernel].flops_cell + n_edge*RL_count[kernel].flops_edge;
+}
+#endif
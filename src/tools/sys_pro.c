@@ -7,6 +7,12 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <time.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "../include_cii/mem.h"
 
 /*
  * To realize cross-platform programming.
@@ -98,8 +104,55 @@ int CreateDir(const char * pPath)
 }
 
 
+/**
+ * @brief This function returns the wall-clock time of OpenMP, or the CPU time of the process without OpenMP.
+ * @return Time in seconds.
+ */
+double wall_time(void)
+{
+#ifdef _OPENMP
+	return omp_get_wtime();
+#else
+	return (double)clock() / (double)CLOCKS_PER_SEC;
+#endif
+}
+
+/**
+ * @brief This function prints the time cost of a stage which starts at time 'tic'.
+ * @param[in] stage: Name of the stage.
+ * @param[in] tic:   Start time of the stage from wall_time().
+ * @return End time of the stage, i.e. the start time of the next stage.
+ */
+double wall_time_stage(const char * stage, const double tic)
+{
+	const double toc = wall_time();
+	printf("  The cost of time for %s is %g seconds.\n", stage, toc - tic);
+	return toc;
+}
+
+/**
+ * @brief This function accumulates the 64-bit FNV-1a hash of a data array.
+ * @details Several arrays are hashed in turn by passing the returned hash as 'h' of the next call.
+ * @param[in] h:      Hash of the preceding data, or HASH_FNV1A_INIT for the first array.
+ * @param[in] data:   Data array.
+ * @param[in] nbytes: Byte length of the data array.
+ * @return Hash of the preceding data and the data array.
+ */
+unsigned long long hash_fnv1a(unsigned long long h, const void * data, const size_t nbytes)
+{
+	const unsigned char * c = (const unsigned char *)data;
+	for(size_t i = 0; i < nbytes; i++)
+	    {
+		h ^= c[i];
+		h *= 1099511628211ULL;
+	    }
+	return h;
+}
+
+
 /**
  * @brief This is a function that initializes memory for double-precision floating-point data.
+ * @details The memory is accounted under the tag "per-edge arrays" and freed by FREE().
  * @param[out] p: Pointer of data.
  * @param[in]  n: Number of grid cells.
  * @param[in] cell_pt[]: cell_pt[k][0] is the number of grid node on the k-th grid cell in the clockwise direction..
@@ -107,24 +160,13 @@ int CreateDir(const char * pPath)
 void init_mem(double * p[], const int n, int ** cell_pt)
 {
 	for(int k = 0; k < n; ++k)
-		{
-			p[k] = (double *)calloc(cell_pt[k][0], sizeof(double));
-			if(p[k] == NULL)
-				{
-					printf("Initialize memory fail! DOUBLE data at grid cell points.\n");
-					for(int j = 0; j < k; j++)
-						{
-							free(p[k]);
-							p[k] = NULL;
-						}
-					exit(5);
-				}
-		}
+		p[k] = (double *)CALLOC_TAG(cell_pt[k][0], sizeof(double), "per-edge arrays");
 }
 
 
 /**
  * @brief This is a function that initializes memory for integer data.
+ * @details The memory is accounted under the tag "per-edge arrays" and freed by FREE().
  * @param[out] p: Pointer of data.
  * @param[in]  n: Number of grid cells.
  * @param[in] cell_pt[]: cell_pt[k][0] is the number of grid node on the k-th grid cell in the clockwise direction..
@@ -132,17 +174,44 @@ void init_mem(double * p[], const int n, int ** cell_pt)
 void init_mem_int(int * p[], const int n, int ** cell_pt)
 {
 	for(int k = 0; k < n; ++k)
-		{
-			p[k] = (int *)malloc(cell_pt[k][0] * sizeof(int));
-			if(p[k] == NULL)
-				{
-					printf("Initialize memory fail! INT data at grid cell points.\n");
-					for(int j = 0; j < k; j++)
-						{
-							free(p[k]);
-							p[k] = NULL;
-						}
-					exit(5);
-				}
-		}
+		p[k] = (int *)ALLOC_TAG(cell_pt[k][0] * sizeof(int), "per-edge arrays");
+}
+
+
+/**
+ * @brief This is a function that allocates a 2-D array of double-precision floating-point data with ghost layers.
+ * @details The M*N interior values and the g ghost layers around them lie in one contiguous zeroed block,
+ *          so v[-g…M-1+g][-g…N-1+g] are valid and each row v[j] is unit stride.
+ *          The memory is accounted under the tag "fields", a failure raises the exception Mem_Failed.
+ * @param[in] M: Number of the rows (x-grids).
+ * @param[in] N: Number of the columns (y-grids).
+ * @param[in] g: Width of the ghost layers.
+ * @return    Pointer to the interior row 0.
+ */
+double ** ghost_mem_2D(const int M, const int N, const int g)
+{
+	int const N_g = N + 2*g;
+	double ** v = (double **)ALLOC_TAG((M + 2*g) * sizeof(double *), "fields");
+	v[0] = (double *)CALLOC_TAG((long)(M + 2*g) * N_g, sizeof(double), "fields");
+	for(int j = 1; j < M + 2*g; ++j)
+		v[j] = v[j-1] + N_g;
+	for(int j = 0; j < M + 2*g; ++j)
+		v[j] += g;
+	return v + g;
+}
+
+
+/**
+ * @brief This is a function that frees a 2-D array allocated by ghost_mem_2D().
+ * @param[in] v: Pointer to the interior row 0, NULL is allowed.
+ * @param[in] g: Width of the ghost layers.
+ */
+void ghost_mem_free_2D(double ** v, const int g)
+{
+	if(v == NULL)
+		return;
+	double * block = v[-g] - g;
+	v -= g;
+	FREE(block);
+	FREE(v);
 }
@@ -0,0 +1,119 @@
+/**
+ * @file  timeline.c
+ * @brief There are functions which record the timeline of the solver phases on each thread.
+ * @details If TIMELINE is defined, TL_BEGIN()/TL_END() record a complete event (name, start, end) of a phase
+ *          into a ring buffer of the calling thread, the oldest events are overwritten when the buffer is full.
+ *          The events are written at exit into the file TIMELINE_FILE in the Chrome trace JSON format,
+ *          which is opened by chrome://tracing or https://ui.perfetto.dev to inspect the load imbalance and the waits at barriers.
+ *          Otherwise the macros expand to nothing and nothing is compiled here.
+ */
+
+#include "../include/tools.h"
+
+#ifdef TIMELINE
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifndef TIMELINE_LEN
+//! Number of events in the ring buffer of each thread, a power of 2.
+#define TIMELINE_LEN 65536
+#endif
+#ifndef TIMELINE_FILE
+//! Name of the trace file.
+#define TIMELINE_FILE "timeline.json"
+#endif
+//! Maximum number of traced threads, the events of the threads beyond it are dropped.
+#define TIMELINE_THREADS 256
+
+//! Ring buffer of the events of a thread.
+struct timeline_buf {
+	const char * name[TIMELINE_LEN]; //!< Names of the phases, string literals.
+	double t0[TIMELINE_LEN], t1[TIMELINE_LEN];
+	unsigned long long len; //!< Number of the events recorded ever.
+};
+
+static struct timeline_buf * TL_buf[TIMELINE_THREADS];
+static int TL_init = 0;
+
+/**
+ * @brief This function writes the events of all threads into the trace file, registered by atexit().
+ */
+static void timeline_dump(void)
+{
+	FILE * fp;
+	unsigned long long e, len, lost = 0;
+	double t_0 = INFINITY; // time origin of the trace
+	int t, comma = 0;
+	for (t = 0; t < TIMELINE_THREADS; t++)
+		if (TL_buf[t])
+			for (e = 0; e < TL_buf[t]->len && e < TIMELINE_LEN; e++)
+				t_0 = fmin(t_0, TL_buf[t]->t0[e]);
+	if ((fp = fopen(TIMELINE_FILE, "w")) == NULL)
+		{
+			printf("Warning: Can't write the timeline file(%s)!\n", TIMELINE_FILE);
+			return;
+		}
+	fprintf(fp, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+	for (t = 0; t < TIMELINE_THREADS; t++)
+		{
+			if (TL_buf[t] == NULL)
+				continue;
+			fprintf(fp, "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": %d, \"args\": {\"name\": \"thread %d\"}}",
+				comma++ ? ",\n" : "", t, t);
+			len = TL_buf[t]->len;
+			e   = len > TIMELINE_LEN ? len - TIMELINE_LEN : 0;
+			lost += e;
+			for (; e < len; e++)
+				fprintf(fp, ",\n{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 0, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f}",
+					TL_buf[t]->name[e % TIMELINE_LEN], t,
+					(TL_buf[t]->t0[e % TIMELINE_LEN] - t_0) * 1e6,
+					(TL_buf[t]->t1[e % TIMELINE_LEN] - TL_buf[t]->t0[e % TIMELINE_LEN]) * 1e6);
+			free(TL_buf[t]);
+			TL_buf[t] = NULL;
+		}
+	fprintf(fp, "\n]}\n");
+	if (fclose(fp) != 0)
+		printf("Warning: Fail to write the timeline file(%s)!\n", TIMELINE_FILE);
+	else if (lost)
+		printf("Timeline written to %s, the oldest %llu events were overwritten.\n", TIMELINE_FILE, lost);
+	else
+		printf("Timeline written to %s.\n", TIMELINE_FILE);
+}
+
+/**
+ * @brief This function records an event of a phase on the calling thread.
+ * @param[in] name: Name of the phase, it must be a string literal.
+ * @param[in] t0:   Start time of the phase from wall_time().
+ */
+void timeline_event(const char * name, const double t0)
+{
+	const double t1 = wall_time();
+	struct timeline_buf * b;
+	int t = 0;
+#ifdef _OPENMP
+	t = omp_get_thread_num();
+	if (t >= TIMELINE_THREADS)
+		return;
+#endif
+	if (TL_buf[t] == NULL)
+		{
+#pragma omp critical (timeline)
+			if (!TL_init)
+				{
+					TL_init = 1;
+					atexit(timeline_dump);
+				}
+			if ((b = (struct timeline_buf *)calloc(1, sizeof(struct timeline_buf))) == NULL)
+				return;
+			TL_buf[t] = b;
+		}
+	b = TL_buf[t];
+	b->name[b->len % TIMELINE_LEN] = name;
+	b->t0  [b->len % TIMELINE_LEN] = t0;
+	b->t1  [b->len % TIMELINE_LEN] = t1;
+	b->len++;
+}
+#endif